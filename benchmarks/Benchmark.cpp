@@ -0,0 +1,94 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <stdexcept>
+
+namespace Benchmark {
+
+namespace {
+
+std::vector<std::pair<std::string, Group>>& getRegisteredGroups() {
+  // The groups are registered during static initialization; a function-local static avoids depending on the initialization order
+  static std::vector<std::pair<std::string, Group>> groups;
+  return groups;
+}
+
+void writeJsonString(std::ostream& stream, const std::string& str) {
+  stream << '"';
+
+  for (const char character : str) {
+    if (character == '"' || character == '\\')
+      stream << '\\';
+    stream << character;
+  }
+
+  stream << '"';
+}
+
+} // namespace
+
+void Runner::writeJson(std::ostream& stream) const {
+  stream << std::fixed << std::setprecision(3) << "{\n  \"benchmarks\": [";
+
+  for (std::size_t resultIndex = 0; resultIndex < m_results.size(); ++resultIndex) {
+    const Result& result = m_results[resultIndex];
+
+    stream << (resultIndex == 0 ? "\n" : ",\n") << "    {\"name\": ";
+    writeJsonString(stream, result.name);
+    stream << ", \"itemCount\": " << result.itemCount
+           << ", \"iterationCount\": " << result.iterationCount
+           << ", \"sampleCount\": " << result.sampleCount
+           << ", \"minTime\": " << result.minTime
+           << ", \"medianTime\": " << result.medianTime
+           << ", \"meanTime\": " << result.meanTime
+           << ", \"maxTime\": " << result.maxTime
+           << ", \"itemsPerSecond\": " << result.itemsPerSecond << '}';
+  }
+
+  stream << "\n  ],\n  \"timeUnit\": \"ns\"\n}\n";
+}
+
+void Runner::addResult(const std::string& name, std::size_t itemCount, std::size_t iterationCount, std::vector<double> sampleTimes) {
+  std::sort(sampleTimes.begin(), sampleTimes.end());
+
+  Result& result        = m_results.emplace_back();
+  result.name           = name;
+  result.itemCount      = itemCount;
+  result.iterationCount = iterationCount;
+  result.sampleCount    = sampleTimes.size();
+  result.minTime        = sampleTimes.front();
+  result.medianTime     = sampleTimes[sampleTimes.size() / 2];
+  result.meanTime       = std::accumulate(sampleTimes.cbegin(), sampleTimes.cend(), 0.0) / static_cast<double>(sampleTimes.size());
+  result.maxTime        = sampleTimes.back();
+  result.itemsPerSecond = static_cast<double>(itemCount) * 1'000'000'000.0 / result.medianTime;
+
+  std::printf("%-64s %14.1f ns %14.1f ns %16.0f items/s\n", name.c_str(), result.medianTime, result.minTime, result.itemsPerSecond);
+  std::fflush(stdout);
+}
+
+GroupRegistrar::GroupRegistrar(const char* name, Group group) {
+  getRegisteredGroups().emplace_back(name, group);
+}
+
+std::vector<std::pair<std::string, Group>> getGroups() {
+  std::vector<std::pair<std::string, Group>> groups = getRegisteredGroups();
+  std::sort(groups.begin(), groups.end(), [] (const auto& group1, const auto& group2) { return (group1.first < group2.first); });
+  return groups;
+}
+
+std::size_t getFileSize(const Raz::FilePath& filePath) {
+  std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+
+  if (!file)
+    throw std::invalid_argument("Error: Unable to open the file '" + filePath + "'");
+
+  return static_cast<std::size_t>(file.tellg());
+}
+
+} // namespace Benchmark
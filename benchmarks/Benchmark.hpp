@@ -0,0 +1,149 @@
+#pragma once
+
+#ifndef RAZ_BENCHMARK_HPP
+#define RAZ_BENCHMARK_HPP
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(RAZ_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+namespace Raz {
+
+class FilePath;
+
+} // namespace Raz
+
+namespace Benchmark {
+
+/// Timings of a single benchmark, measured over several samples.
+struct Result {
+  std::string name {};
+  std::size_t itemCount {}; ///< Number of items processed by each iteration.
+  std::size_t iterationCount {}; ///< Number of iterations executed in each sample.
+  std::size_t sampleCount {};
+  double minTime {}; ///< Fastest sample's time per iteration, in nanoseconds.
+  double medianTime {}; ///< Median sample's time per iteration, in nanoseconds.
+  double meanTime {}; ///< Average time per iteration over all samples, in nanoseconds.
+  double maxTime {}; ///< Slowest sample's time per iteration, in nanoseconds.
+  double itemsPerSecond {}; ///< Number of items processed per second, computed from the median time.
+};
+
+/// Runner executing benchmarks & gathering their results.
+/// Each benchmark is first calibrated, doubling its number of iterations until a sample lasts long enough for the clock's
+///   resolution to be negligible; a fixed number of samples is then measured, from which the results are computed.
+class Runner {
+public:
+  /// Creates a runner.
+  /// \param filter Text the benchmarks' names must contain to be executed; all of them are if empty.
+  explicit Runner(std::string filter = {}) : m_filter{ std::move(filter) } {}
+
+  const std::vector<Result>& getResults() const noexcept { return m_results; }
+
+  /// Runs a benchmark, if its name matches the filter.
+  /// \tparam FuncT Type of the function to be benchmarked.
+  /// \param name Name of the benchmark, which must be unique to allow comparing results.
+  /// \param func Function to be benchmarked, called once per iteration. Any setup must be done outside of it.
+  /// \param itemCount Number of items processed by each call to the function.
+  template <typename FuncT>
+  void run(const std::string& name, FuncT&& func, std::size_t itemCount = 1);
+  /// Writes the results gathered so far in JSON.
+  /// \param stream Stream to write the results into.
+  void writeJson(std::ostream& stream) const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr double MinSampleTime = 10'000'000.0; ///< Minimum duration of a sample, in nanoseconds.
+  static constexpr std::size_t MaxIterationCount = 1 << 30;
+  static constexpr std::size_t SampleCount = 11;
+
+  /// Checks if a benchmark has to be executed.
+  /// \param name Name of the benchmark.
+  /// \return True if the benchmark's name matches the filter, false otherwise.
+  bool isSelected(const std::string& name) const { return (m_filter.empty() || name.find(m_filter) != std::string::npos); }
+  /// Computes & prints the results of a benchmark from its samples.
+  /// \param name Name of the benchmark.
+  /// \param itemCount Number of items processed by each iteration.
+  /// \param iterationCount Number of iterations executed in each sample.
+  /// \param sampleTimes Time per iteration of each sample, in nanoseconds.
+  void addResult(const std::string& name, std::size_t itemCount, std::size_t iterationCount, std::vector<double> sampleTimes);
+
+  std::string m_filter {};
+  std::vector<Result> m_results {};
+};
+
+/// Function registering benchmarks into the given runner.
+using Group = void (*)(Runner&);
+
+/// Registers a group of benchmarks, so that it gets executed by the main function. This should be used through the
+///   BENCHMARK_GROUP macro.
+struct GroupRegistrar {
+  GroupRegistrar(const char* name, Group group);
+};
+
+/// Gets all the registered groups of benchmarks, sorted by name so that the execution order is reproducible.
+/// \return Registered groups, associated with their name.
+std::vector<std::pair<std::string, Group>> getGroups();
+
+/// Gets the size of a file, to compute the throughput of the benchmarks reading it.
+/// \param filePath Path to the file.
+/// \return Size of the file in bytes.
+std::size_t getFileSize(const Raz::FilePath& filePath);
+
+/// Prevents the compiler from optimizing away a value, or the computations leading to it.
+/// \tparam T Type of the value.
+/// \param value Value to be kept.
+template <typename T>
+void doNotOptimize(const T& value) {
+#if defined(RAZ_COMPILER_MSVC)
+  static const void* volatile sink {};
+  sink = &value;
+  _ReadWriteBarrier();
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+template <typename FuncT>
+void Runner::run(const std::string& name, FuncT&& func, std::size_t itemCount) {
+  if (!isSelected(name))
+    return;
+
+  const auto measure = [&func] (std::size_t iterationCount) {
+    const Clock::time_point startTime = Clock::now();
+
+    for (std::size_t iterationIndex = 0; iterationIndex < iterationCount; ++iterationIndex)
+      func();
+
+    return std::chrono::duration<double, std::nano>(Clock::now() - startTime).count();
+  };
+
+  std::size_t iterationCount = 1;
+  while (iterationCount < MaxIterationCount && measure(iterationCount) < MinSampleTime)
+    iterationCount *= 2;
+
+  std::vector<double> sampleTimes(SampleCount);
+  for (double& sampleTime : sampleTimes)
+    sampleTime = measure(iterationCount) / static_cast<double>(iterationCount);
+
+  addResult(name, itemCount, iterationCount, std::move(sampleTimes));
+}
+
+} // namespace Benchmark
+
+#define BENCHMARK_CONCAT_IMPL(FIRST, SECOND) FIRST##SECOND
+#define BENCHMARK_CONCAT(FIRST, SECOND) BENCHMARK_CONCAT_IMPL(FIRST, SECOND)
+
+/// Defines a group of benchmarks, automatically registered to be executed. The group's body receives a 'runner' to run them.
+#define BENCHMARK_GROUP(NAME) \
+  static void BENCHMARK_CONCAT(benchmarkGroup, __LINE__)(Benchmark::Runner&); \
+  static const Benchmark::GroupRegistrar BENCHMARK_CONCAT(groupRegistrar, __LINE__)(NAME, &BENCHMARK_CONCAT(benchmarkGroup, __LINE__)); \
+  static void BENCHMARK_CONCAT(benchmarkGroup, __LINE__)(Benchmark::Runner& runner)
+
+#endif // RAZ_BENCHMARK_HPP
@@ -0,0 +1,45 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Window.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+int main(int argc, char* argv[]) {
+  std::string outputPath = "RaZ_Benchmarks.json";
+  std::string filter;
+
+  for (int argIndex = 1; argIndex < argc; ++argIndex) {
+    if (std::strcmp(argv[argIndex], "--output") == 0 && argIndex + 1 < argc) {
+      outputPath = argv[++argIndex];
+    } else if (std::strcmp(argv[argIndex], "--filter") == 0 && argIndex + 1 < argc) {
+      filter = argv[++argIndex];
+    } else {
+      std::printf("Usage: %s [--output <results.json>] [--filter <name part>]\n", argv[0]);
+      return (std::strcmp(argv[argIndex], "--help") == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+  }
+
+  // Importing meshes may create textures, which requires an OpenGL context to be instantiated by the Window
+  const Raz::Window window(1, 1, "", Raz::WindowSetting::INVISIBLE);
+
+  Benchmark::Runner runner(std::move(filter));
+
+  std::printf("%-64s %17s %17s %24s\n", "Benchmark", "Median", "Min", "Throughput");
+
+  for (const auto& [name, group] : Benchmark::getGroups())
+    group(runner);
+
+  std::ofstream outputFile(outputPath, std::ios_base::out | std::ios_base::binary);
+
+  if (!outputFile) {
+    std::fprintf(stderr, "Error: Unable to write the results into '%s'\n", outputPath.c_str());
+    return EXIT_FAILURE;
+  }
+
+  runner.writeJson(outputFile);
+  std::printf("Results written into '%s'\n", outputPath.c_str());
+
+  return EXIT_SUCCESS;
+}
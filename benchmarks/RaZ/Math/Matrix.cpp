@@ -0,0 +1,64 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t ValueCount = 1024;
+
+std::vector<Raz::Mat4f> createMatrices() {
+  // The seed is fixed so that the values, & thus the results, are reproducible
+  std::mt19937 randGenerator(42);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+  std::vector<Raz::Mat4f> matrices(ValueCount);
+
+  for (Raz::Mat4f& matrix : matrices) {
+    for (float& value : matrix.getData())
+      value = distribution(randGenerator);
+  }
+
+  return matrices;
+}
+
+} // namespace
+
+BENCHMARK_GROUP("Matrix") {
+  const std::vector<Raz::Mat4f> matrices = createMatrices();
+  std::vector<Raz::Mat4f> results(ValueCount);
+
+  runner.run("Mat4f * Mat4f", [&matrices, &results] () {
+    for (std::size_t matIndex = 0; matIndex < ValueCount; ++matIndex)
+      results[matIndex] = matrices[matIndex] * matrices[(matIndex + 1) % ValueCount];
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  std::vector<Raz::Vec4f> vectors(ValueCount, Raz::Vec4f(1.f));
+  runner.run("Mat4f * Vec4f", [&matrices, &vectors] () {
+    for (std::size_t matIndex = 0; matIndex < ValueCount; ++matIndex)
+      vectors[matIndex] = matrices[matIndex] * vectors[(matIndex + 1) % ValueCount];
+    Benchmark::doNotOptimize(vectors.data());
+  }, ValueCount);
+
+  runner.run("Mat4f::transpose", [&matrices, &results] () {
+    for (std::size_t matIndex = 0; matIndex < ValueCount; ++matIndex)
+      results[matIndex] = matrices[matIndex].transpose();
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  runner.run("Mat4f::inverse", [&matrices, &results] () {
+    for (std::size_t matIndex = 0; matIndex < ValueCount; ++matIndex)
+      results[matIndex] = matrices[matIndex].inverse();
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  runner.run("Mat4f::computeDeterminant", [&matrices] () {
+    float determinantSum = 0.f;
+    for (const Raz::Mat4f& matrix : matrices)
+      determinantSum += matrix.computeDeterminant();
+    Benchmark::doNotOptimize(determinantSum);
+  }, ValueCount);
+}
@@ -0,0 +1,71 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Quaternion.hpp"
+#include "RaZ/Utils/FloatUtils.hpp"
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t ValueCount = 1024;
+
+std::vector<Raz::Quaternionf> createQuaternions() {
+  // The seed is fixed so that the values, & thus the results, are reproducible
+  std::mt19937 randGenerator(42);
+  std::uniform_real_distribution<float> angleDistribution(-Raz::Pi<float>, Raz::Pi<float>);
+  std::uniform_real_distribution<float> axisDistribution(0.1f, 1.f);
+
+  std::vector<Raz::Quaternionf> quaternions;
+  quaternions.reserve(ValueCount);
+
+  while (quaternions.size() < ValueCount) {
+    const Raz::Radiansf angle(angleDistribution(randGenerator));
+    const Raz::Vec3f axis(axisDistribution(randGenerator), axisDistribution(randGenerator), axisDistribution(randGenerator));
+    const Raz::Quaternionf quaternion(angle, axis.normalize());
+
+    // Slerp requires the quaternions' norm to be 1 up to an epsilon, which rounding errors may exceed
+    if (Raz::FloatUtils::areNearlyEqual(quaternion.computeSquaredNorm(), 1.f))
+      quaternions.emplace_back(quaternion);
+  }
+
+  return quaternions;
+}
+
+} // namespace
+
+BENCHMARK_GROUP("Quaternion") {
+  const std::vector<Raz::Quaternionf> quaternions = createQuaternions();
+  std::vector<Raz::Quaternionf> results(ValueCount, Raz::Quaternionf::identity());
+
+  runner.run("Quaternionf * Quaternionf", [&quaternions, &results] () {
+    for (std::size_t quatIndex = 0; quatIndex < ValueCount; ++quatIndex)
+      results[quatIndex] = quaternions[quatIndex] * quaternions[(quatIndex + 1) % ValueCount];
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  runner.run("Quaternionf::normalize", [&quaternions, &results] () {
+    for (std::size_t quatIndex = 0; quatIndex < ValueCount; ++quatIndex)
+      results[quatIndex] = quaternions[quatIndex].normalize();
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  runner.run("Quaternionf::nlerp", [&quaternions, &results] () {
+    for (std::size_t quatIndex = 0; quatIndex < ValueCount; ++quatIndex)
+      results[quatIndex] = quaternions[quatIndex].nlerp(quaternions[(quatIndex + 1) % ValueCount], 0.25f);
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  runner.run("Quaternionf::slerp", [&quaternions, &results] () {
+    for (std::size_t quatIndex = 0; quatIndex < ValueCount; ++quatIndex)
+      results[quatIndex] = quaternions[quatIndex].slerp(quaternions[(quatIndex + 1) % ValueCount], 0.25f);
+    Benchmark::doNotOptimize(results.data());
+  }, ValueCount);
+
+  std::vector<Raz::Mat4f> matrices(ValueCount);
+  runner.run("Quaternionf::computeMatrix", [&quaternions, &matrices] () {
+    for (std::size_t quatIndex = 0; quatIndex < ValueCount; ++quatIndex)
+      matrices[quatIndex] = quaternions[quatIndex].computeMatrix();
+    Benchmark::doNotOptimize(matrices.data());
+  }, ValueCount);
+}
@@ -0,0 +1,59 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Physics/Collider.hpp"
+
+#include <random>
+
+BENCHMARK_GROUP("Collider") {
+  constexpr std::size_t colliderCount = 1'024;
+
+  std::mt19937 randomEngine(42);
+  std::uniform_real_distribution<float> positionDistrib(-10.f, 10.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.5f, 5.f);
+
+  // Planes, spheres & boxes are mixed, so that the dispatch is not predictable
+  std::vector<Raz::Collider> colliders;
+  colliders.reserve(colliderCount);
+
+  for (std::size_t colliderIndex = 0; colliderIndex < colliderCount; ++colliderIndex) {
+    const Raz::Vec3f position(positionDistrib(randomEngine), positionDistrib(randomEngine), positionDistrib(randomEngine));
+    const float size = sizeDistrib(randomEngine);
+
+    switch (randomEngine() % 3) {
+      case 0:
+        colliders.emplace_back(Raz::Plane(position.y(), Raz::Vec3f(position.x(), size, position.z()).normalize()));
+        break;
+
+      case 1:
+        colliders.emplace_back(Raz::Sphere(position, size));
+        break;
+
+      default:
+        colliders.emplace_back(Raz::AABB(position, position + Raz::Vec3f(size)));
+        break;
+    }
+  }
+
+  runner.run("Collider::intersects(Collider) (" + std::to_string(colliderCount) + " pairs)", [&colliders] () {
+    std::size_t hitCount = 0;
+
+    for (std::size_t colliderIndex = 0; colliderIndex < colliderCount; ++colliderIndex)
+      hitCount += colliders[colliderIndex].intersects(colliders[(colliderIndex * 7 + 1) % colliderCount]);
+
+    Benchmark::doNotOptimize(hitCount);
+  }, colliderCount);
+
+  runner.run("Collider::intersects(Shape) (" + std::to_string(colliderCount) + " pairs)", [&colliders] () {
+    std::size_t hitCount = 0;
+
+    for (std::size_t colliderIndex = 0; colliderIndex < colliderCount; ++colliderIndex)
+      hitCount += colliders[colliderIndex].intersects(colliders[(colliderIndex * 7 + 1) % colliderCount].getShape());
+
+    Benchmark::doNotOptimize(hitCount);
+  }, colliderCount);
+
+  runner.run("Collider::computeBoundingBox (" + std::to_string(colliderCount) + " colliders)", [&colliders] () {
+    for (const Raz::Collider& collider : colliders)
+      Benchmark::doNotOptimize(collider.computeBoundingBox());
+  }, colliderCount);
+}
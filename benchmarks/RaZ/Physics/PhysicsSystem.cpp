@@ -0,0 +1,104 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <random>
+
+BENCHMARK_GROUP("PhysicsSystem") {
+  for (const std::size_t bodyCount : { 1'000, 10'000, 100'000 }) {
+    Raz::World world(bodyCount);
+    auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+    for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+      Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(bodyIndex), 0.f, 0.f));
+      entity.addComponent<Raz::RigidBody>(1.f, 0.5f);
+    }
+
+    world.refresh();
+
+    // No collider being present, only the bodies' integration is measured
+    runner.run("PhysicsSystem::step (" + std::to_string(bodyCount) + " bodies)", [&physics] () {
+      physics.step(0.016666f);
+    }, bodyCount);
+  }
+}
+
+BENCHMARK_GROUP("PhysicsSystem raycasts") {
+  constexpr std::size_t colliderCount = 10'000;
+  constexpr std::size_t rayCount      = 10'000;
+
+  std::mt19937 randomEngine(42);
+  std::uniform_real_distribution<float> positionDistrib(-100.f, 100.f);
+
+  Raz::World world(colliderCount);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  for (std::size_t colliderIndex = 0; colliderIndex < colliderCount; ++colliderIndex) {
+    const Raz::Vec3f position(positionDistrib(randomEngine), positionDistrib(randomEngine), positionDistrib(randomEngine));
+    world.addEntityWithComponent<Raz::Transform>(position).addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  }
+
+  world.refresh();
+  physics.step(0.f);
+
+  std::vector<Raz::Ray> rays;
+  rays.reserve(rayCount);
+
+  for (std::size_t rayIndex = 0; rayIndex < rayCount; ++rayIndex) {
+    const Raz::Vec3f origin(positionDistrib(randomEngine), positionDistrib(randomEngine), positionDistrib(randomEngine));
+    const Raz::Vec3f target(positionDistrib(randomEngine), positionDistrib(randomEngine), positionDistrib(randomEngine));
+    rays.emplace_back(origin, (target - origin).normalize());
+  }
+
+  const std::string suffix = " (" + std::to_string(rayCount) + " rays, " + std::to_string(colliderCount) + " colliders)";
+
+  runner.run("PhysicsSystem::raycast" + suffix, [&physics, &rays] () {
+    std::size_t hitCount = 0;
+
+    for (const Raz::Ray& ray : rays)
+      hitCount += physics.raycast(ray);
+
+    Benchmark::doNotOptimize(hitCount);
+  }, rayCount);
+
+  runner.run("PhysicsSystem::raycastMany" + suffix, [&physics, &rays] () {
+    Benchmark::doNotOptimize(physics.raycastMany(rays));
+  }, rayCount);
+}
+
+BENCHMARK_GROUP("PhysicsSystem contacts") {
+  // Stacks of bodies resting on the ground, kept awake so that their contacts are solved at each step
+  constexpr std::size_t stackCount  = 1'024;
+  constexpr std::size_t stackHeight = 4;
+  constexpr std::size_t bodyCount   = stackCount * stackHeight;
+
+  Raz::World world(bodyCount + 1);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.enableSleeping(false);
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f));
+
+  for (std::size_t stackIndex = 0; stackIndex < stackCount; ++stackIndex) {
+    const auto stackX = static_cast<float>(stackIndex % 32) * 2.f;
+    const auto stackZ = static_cast<float>(stackIndex / 32) * 2.f;
+
+    for (std::size_t bodyIndex = 0; bodyIndex < stackHeight; ++bodyIndex) {
+      Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(stackX, static_cast<float>(bodyIndex) * 0.5f, stackZ));
+      entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+      entity.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+    }
+  }
+
+  world.refresh();
+
+  for (std::size_t stepIndex = 0; stepIndex < 100; ++stepIndex)
+    physics.step(0.016666f);
+
+  runner.run("PhysicsSystem::step (" + std::to_string(bodyCount) + " stacked bodies)", [&physics] () {
+    physics.step(0.016666f);
+  }, bodyCount);
+}
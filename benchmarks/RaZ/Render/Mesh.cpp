@@ -0,0 +1,56 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+/// Writes an OFF file representing a flat grid made of quads; no OFF file being bundled with the assets, this gives a
+///   reproducible input of a relevant size.
+/// \param filePath Path to the file to be written.
+/// \param sideVertexCount Number of vertices on each side of the grid.
+void writeOffGrid(const Raz::FilePath& filePath, std::size_t sideVertexCount) {
+  std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+
+  const std::size_t sideFaceCount = sideVertexCount - 1;
+  file << "OFF\n" << sideVertexCount * sideVertexCount << ' ' << sideFaceCount * sideFaceCount << " 0\n";
+
+  for (std::size_t rowIndex = 0; rowIndex < sideVertexCount; ++rowIndex) {
+    for (std::size_t columnIndex = 0; columnIndex < sideVertexCount; ++columnIndex)
+      file << static_cast<float>(columnIndex) * 0.1f << ' ' << static_cast<float>(rowIndex) * 0.1f << " 0\n";
+  }
+
+  for (std::size_t rowIndex = 0; rowIndex < sideFaceCount; ++rowIndex) {
+    for (std::size_t columnIndex = 0; columnIndex < sideFaceCount; ++columnIndex) {
+      const std::size_t firstIndex = rowIndex * sideVertexCount + columnIndex;
+      file << "4 " << firstIndex << ' ' << firstIndex + 1 << ' ' << firstIndex + sideVertexCount + 1 << ' ' << firstIndex + sideVertexCount << '\n';
+    }
+  }
+}
+
+} // namespace
+
+BENCHMARK_GROUP("Mesh") {
+  // The throughput of the imports is given in bytes per second
+  for (const char* meshName : { "ball.obj", "bigguy.obj", "car.obj", "shield.obj", "cerberus.obj" }) {
+    const Raz::FilePath meshPath = RAZ_ROOT + std::string("assets/meshes/") + meshName;
+
+    runner.run(std::string("Mesh OBJ import (") + meshName + ')', [&meshPath] () {
+      const Raz::Mesh mesh(meshPath);
+      Benchmark::doNotOptimize(mesh.recoverVertexCount());
+    }, Benchmark::getFileSize(meshPath));
+  }
+
+  const std::string offPath = "benchmarkGrid.off";
+  writeOffGrid(offPath, 256);
+
+  runner.run("Mesh OFF import (256x256 grid)", [&offPath] () {
+    const Raz::Mesh mesh(offPath);
+    Benchmark::doNotOptimize(mesh.recoverVertexCount());
+  }, Benchmark::getFileSize(offPath));
+
+  std::remove(offPath.c_str());
+}
@@ -0,0 +1,16 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Image.hpp"
+
+BENCHMARK_GROUP("Image") {
+  // The throughput of the imports is given in bytes per second
+  for (const char* imageName : { "icons/RaZ_logo_128.png", "icons/RaZ_logo_512.png", "textures/cerberus_albedo.png" }) {
+    const Raz::FilePath imagePath = RAZ_ROOT + std::string("assets/") + imageName;
+
+    runner.run(std::string("Image PNG import (") + imageName + ')', [&imagePath] () {
+      const Raz::Image image(imagePath);
+      Benchmark::doNotOptimize(image.getDataPtr());
+    }, Benchmark::getFileSize(imagePath));
+  }
+}
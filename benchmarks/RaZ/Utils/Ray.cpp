@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t RayCount = 1024;
+
+/// Creates rays starting around the origin & pointing in random directions; roughly half of them hit the shapes tested below.
+std::vector<Raz::Ray> createRays() {
+  // The seed is fixed so that the values, & thus the results, are reproducible
+  std::mt19937 randGenerator(42);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+  std::vector<Raz::Ray> rays;
+  rays.reserve(RayCount);
+
+  for (std::size_t rayIndex = 0; rayIndex < RayCount; ++rayIndex) {
+    const Raz::Vec3f origin(distribution(randGenerator), distribution(randGenerator), distribution(randGenerator));
+    const Raz::Vec3f direction(distribution(randGenerator), distribution(randGenerator), 1.f);
+    rays.emplace_back(origin, direction.normalize());
+  }
+
+  return rays;
+}
+
+} // namespace
+
+BENCHMARK_GROUP("Ray") {
+  const std::vector<Raz::Ray> rays = createRays();
+  const Raz::AABB aabb(Raz::Vec3f(-1.f, -1.f, 4.f), Raz::Vec3f(1.f, 1.f, 6.f));
+  const Raz::Triangle triangle(Raz::Vec3f(-2.f, -2.f, 5.f), Raz::Vec3f(2.f, -2.f, 5.f), Raz::Vec3f(0.f, 2.f, 5.f));
+
+  runner.run("Ray/AABB intersection", [&rays, &aabb] () {
+    std::size_t hitCount = 0;
+    for (const Raz::Ray& ray : rays)
+      hitCount += ray.intersects(aabb);
+    Benchmark::doNotOptimize(hitCount);
+  }, RayCount);
+
+  runner.run("Ray/AABB intersection (hit)", [&rays, &aabb] () {
+    Raz::RayHit hit;
+    for (const Raz::Ray& ray : rays)
+      ray.intersects(aabb, &hit);
+    Benchmark::doNotOptimize(hit);
+  }, RayCount);
+
+  runner.run("Ray/triangle intersection", [&rays, &triangle] () {
+    std::size_t hitCount = 0;
+    for (const Raz::Ray& ray : rays)
+      hitCount += ray.intersects(triangle);
+    Benchmark::doNotOptimize(hitCount);
+  }, RayCount);
+
+  runner.run("Ray/triangle intersection (hit)", [&rays, &triangle] () {
+    Raz::RayHit hit;
+    for (const Raz::Ray& ray : rays)
+      ray.intersects(triangle, &hit);
+    Benchmark::doNotOptimize(hit);
+  }, RayCount);
+
+  std::vector<Raz::RayPacket<8>> packets;
+  for (std::size_t rayIndex = 0; rayIndex < RayCount; rayIndex += 8)
+    packets.emplace_back(&rays[rayIndex], 8);
+
+  runner.run("RayPacket<8>/AABB intersection", [&packets, &aabb] () {
+    uint32_t hitMask = 0;
+    for (const Raz::RayPacket<8>& packet : packets)
+      hitMask ^= packet.intersects(aabb);
+    Benchmark::doNotOptimize(hitMask);
+  }, RayCount);
+
+  runner.run("RayPacket<8>/triangle intersection", [&packets, &triangle] () {
+    uint32_t hitMask = 0;
+    for (const Raz::RayPacket<8>& packet : packets)
+      hitMask ^= packet.intersects(triangle);
+    Benchmark::doNotOptimize(hitMask);
+  }, RayCount);
+}
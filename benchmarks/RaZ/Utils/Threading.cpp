@@ -0,0 +1,54 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Threading.hpp"
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+BENCHMARK_GROUP("Threading") {
+  const std::size_t threadCount = Raz::Threading::getSystemThreadCount();
+
+  // Parallelizing empty actions only measures the cost of dispatching them to the thread pool & waiting for them
+  runner.run("Threading::parallelize (empty, 1 action)", [] () {
+    Raz::Threading::parallelize([] () noexcept {}, 1);
+  });
+
+  if (threadCount > 1) {
+    runner.run("Threading::parallelize (empty, " + std::to_string(threadCount) + " actions)", [threadCount] () {
+      Raz::Threading::parallelize([] () noexcept {}, threadCount);
+    }, threadCount);
+  }
+
+  for (const std::size_t valueCount : { 1'000, 100'000 }) {
+    std::vector<float> values(valueCount);
+    std::iota(values.begin(), values.end(), 0.f);
+
+    const std::string countSuffix = " (" + std::to_string(valueCount) + " values)";
+
+    runner.run("Sequential sum" + countSuffix, [&values] () {
+      Benchmark::doNotOptimize(std::accumulate(values.cbegin(), values.cend(), 0.f));
+    }, valueCount);
+
+    std::vector<float> partialSums(threadCount);
+    std::atomic<std::size_t> partialSumIndex = 0;
+
+    runner.run("Threading::parallelize sum" + countSuffix, [&values, &partialSums, &partialSumIndex, threadCount] () {
+      std::fill(partialSums.begin(), partialSums.end(), 0.f);
+      partialSumIndex = 0;
+
+      Raz::Threading::parallelize(values, [&values, &partialSums, &partialSumIndex] (Raz::Threading::IndexRange range) noexcept {
+        float sum = 0.f;
+        for (std::size_t valueIndex = range.beginIndex; valueIndex < range.endIndex; ++valueIndex)
+          sum += values[valueIndex];
+        partialSums[partialSumIndex++] = sum;
+      }, threadCount);
+
+      Benchmark::doNotOptimize(std::accumulate(partialSums.cbegin(), partialSums.cend(), 0.f));
+    }, valueCount);
+  }
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+BENCHMARK_GROUP("World") {
+  for (const std::size_t entityCount : { 1'000, 10'000, 100'000 }) {
+    const std::string countSuffix = " (" + std::to_string(entityCount) + " entities)";
+
+    // Half of the entities also have a rigid body, so that queries on both components have entities to skip
+    Raz::World world(entityCount);
+
+    for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex) {
+      Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(entityIndex)));
+
+      if (entityIndex % 2 == 0)
+        entity.addComponent<Raz::RigidBody>(1.f, 0.5f);
+    }
+
+    world.refresh();
+
+    runner.run("World entities iteration" + countSuffix, [&world] () {
+      std::size_t transformCount = 0;
+
+      for (const Raz::EntityPtr& entity : world.getEntities())
+        transformCount += entity->hasComponent<Raz::Transform>();
+
+      Benchmark::doNotOptimize(transformCount);
+    }, entityCount);
+
+    const Raz::EntityView<Raz::Transform> transforms = world.view<Raz::Transform>();
+    runner.run("World view<Transform> iteration" + countSuffix, [&transforms] () {
+      transforms.forEach([] (Raz::Transform& transform) { Benchmark::doNotOptimize(transform.getPosition()); });
+    }, entityCount);
+
+    const Raz::EntityView<Raz::Transform, Raz::RigidBody> rigidBodies = world.view<Raz::Transform, Raz::RigidBody>();
+    runner.run("World view<Transform, RigidBody> iteration" + countSuffix, [&rigidBodies] () {
+      rigidBodies.forEach([] (const Raz::Transform& transform, const Raz::RigidBody& rigidBody) {
+        Benchmark::doNotOptimize(transform.getPosition() * rigidBody.getMass());
+      });
+    }, entityCount / 2);
+
+    // Entities are disabled then enabled back, each step being followed by a refresh which has to reorder them
+    for (const std::size_t toggleStep : { 10, 1 }) {
+      runner.run("World refresh (" + std::to_string(100 / toggleStep) + "% toggled)" + countSuffix, [&world, toggleStep] () {
+        const std::vector<Raz::EntityPtr>& entities = world.getEntities();
+
+        for (std::size_t entityIndex = 0; entityIndex < entities.size(); entityIndex += toggleStep)
+          entities[entityIndex]->disable();
+        world.refresh();
+
+        for (std::size_t entityIndex = 0; entityIndex < entities.size(); entityIndex += toggleStep)
+          entities[entityIndex]->enable();
+        world.refresh();
+      }, entityCount * 2 / toggleStep);
+    }
+  }
+}
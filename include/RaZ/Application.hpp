@@ -12,13 +12,58 @@
 
 namespace Raz {
 
+/// Application class, running the worlds it holds until none of them remains active.
+/// No window nor graphics context is needed unless a world renders; an application can thus run headless, for instance as a
+///   dedicated server or for offline simulations. In this case, a fixed time step & a target tick rate can be set, so that the
+///   worlds are stepped deterministically either as fast as possible or at a steady rate.
 class Application {
 public:
+  /// Statistics of the application's cycles, excluding the time spent waiting to match the target tick rate.
+  struct TickStats {
+    std::size_t tickCount {}; ///< Number of cycles run since the statistics have been reset.
+    double averageTime {}; ///< Average time taken by a cycle, in milliseconds.
+    double minTime {}; ///< Minimum time taken by a cycle, in milliseconds.
+    double maxTime {}; ///< Maximum time taken by a cycle, in milliseconds.
+    double lastTime {}; ///< Time taken by the last cycle, in milliseconds.
+  };
+
   explicit Application(std::size_t worldCount = 1) { m_worlds.reserve(worldCount); }
 
   const std::vector<World>& getWorlds() const { return m_worlds; }
   std::vector<World>& getWorlds() { return m_worlds; }
   float getDeltaTime() const { return m_deltaTime; }
+  float getFixedTimeStep() const noexcept { return m_fixedTimeStep; }
+  float getTargetTickRate() const noexcept { return m_targetTickRate; }
+  const TickStats& getTickStats() const noexcept { return m_tickStats; }
+  /// Checks if the worlds are updated concurrently.
+  /// \return True if the worlds are updated in parallel, false if they are updated one after the other.
+  bool isUpdatingWorldsInParallel() const noexcept { return m_isUpdatingWorldsInParallel; }
+  /// Checks if the given world is pinned to the main thread.
+  /// \param worldIndex Index of the world to be checked.
+  /// \return True if the world is always updated on the thread running the application, false otherwise.
+  bool isWorldPinnedToMainThread(std::size_t worldIndex) const { return (worldIndex < m_pinnedWorlds.getSize() && m_pinnedWorlds[worldIndex]); }
+
+  /// Sets whether the worlds should be updated concurrently on the default thread pool. This is disabled by default.
+  /// The worlds must then be independent from each other, & those needing to be updated on the main thread must be pinned to it.
+  /// \note If threads are not available on the current platform, the worlds are always updated one after the other.
+  /// \param enabled True if the worlds should be updated in parallel, false otherwise.
+  void updateWorldsInParallel(bool enabled = true) { m_isUpdatingWorldsInParallel = enabled; }
+  /// Pins a world to the main thread, so that it is always updated on the thread running the application, even when the
+  ///   worlds are updated in parallel. This is needed for worlds which render, since the graphics context belongs to this thread.
+  /// \param worldIndex Index of the world to be pinned.
+  /// \param pinned True if the world should be pinned to the main thread, false otherwise.
+  void pinWorldToMainThread(std::size_t worldIndex, bool pinned = true);
+  /// Sets a fixed time step, given to the worlds on each cycle instead of the actual time elapsed since the previous one. This
+  ///   makes the simulation deterministic regardless of the time the cycles take. This is disabled by default.
+  /// \param timeStep Time step to be used, in seconds; 0 to use the elapsed time.
+  void setFixedTimeStep(float timeStep);
+  /// Sets the number of cycles to be run per second. Cycles are then paced by sleeping, the last moments being spent yielding
+  ///   to start them on time. If a cycle is late by more than one period, the following ones are not run faster to catch up.
+  /// \note This is ignored with Emscripten, whose main loop is driven by the browser.
+  /// \param tickRate Number of cycles per second; 0 to run them as fast as possible, which is the default.
+  void setTargetTickRate(float tickRate);
+  /// Resets the cycles' statistics.
+  void resetTickStats() noexcept { m_tickStats = {}; }
 
   /// Adds a World into the Application.
   /// \tparam Args Types of the arguments to be forwarded to the World.
@@ -38,12 +83,35 @@ public:
   void quit() { m_isRunning = false; }
 
 private:
+  using Clock = std::chrono::steady_clock;
+
+  /// Waits until the next cycle has to be run to match the target tick rate, if any.
+  void waitForNextTick();
+  /// Updates the active worlds one after the other.
+  /// \param currentTime Time at which the cycle has started.
+  void updateWorlds(Clock::time_point currentTime);
+  /// Updates the active worlds concurrently on the default thread pool; the pinned ones are updated on the calling thread.
+  void updateWorldsConcurrently();
+
   std::vector<World> m_worlds {};
   Bitset m_activeWorlds {};
 
-  std::chrono::time_point<std::chrono::system_clock> m_lastFrameTime = std::chrono::system_clock::now();
+  Clock::time_point m_lastFrameTime = Clock::now();
   float m_deltaTime {};
   bool m_isRunning = true;
+
+  float m_fixedTimeStep {};
+  float m_targetTickRate {};
+  Clock::duration m_tickPeriod {};
+  Clock::time_point m_nextTickTime {};
+  TickStats m_tickStats {};
+
+  bool m_isUpdatingWorldsInParallel = false;
+  Bitset m_pinnedWorlds {};
+  /// Time at which each world has last been updated. When updated in parallel, each world's delta time is computed from its own
+  ///   update times, since they may be started at different times depending on the workers' availability.
+  std::vector<Clock::time_point> m_worldUpdateTimes {};
+  std::vector<uint8_t> m_worldUpdateResults {}; ///< Whether each world is still active after its concurrent update.
 };
 
 } // namespace Raz
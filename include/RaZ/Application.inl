@@ -8,6 +8,7 @@ template <typename... Args>
 World& Application::addWorld(Args&&... args) {
   m_worlds.emplace_back(std::forward<Args>(args)...);
   m_activeWorlds.setBit(m_worlds.size() - 1);
+  m_worldUpdateTimes.emplace_back(Clock::now());
 
   return m_worlds.back();
 }
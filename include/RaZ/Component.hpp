@@ -3,12 +3,22 @@
 #ifndef RAZ_COMPONENT_HPP
 #define RAZ_COMPONENT_HPP
 
+#include "RaZ/Utils/PoolAllocator.hpp"
+
 #include <memory>
 
 namespace Raz {
 
 class Component;
-using ComponentPtr = std::unique_ptr<Component>;
+
+/// Deleter of the components created with Component::create(), giving their memory back to the allocator of their type.
+struct ComponentDeleter {
+  void (*destroy)(Component*) = nullptr; ///< Function destroying & deallocating the component; if null, it is simply deleted.
+
+  void operator()(Component* component) const noexcept;
+};
+
+using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
 
 /// Component class representing a base Component to be inherited.
 class Component {
@@ -20,6 +30,16 @@ public:
   /// \tparam T Type of the component to get the ID for.
   /// \return Given component's ID.
   template <typename T> static std::size_t getId();
+  /// Gets the allocator from which the components of the given type are created, keeping them contiguous in memory.
+  /// \tparam Comp Type of the component to get the allocator for.
+  /// \return Reference to the given component's allocator.
+  template <typename Comp> static PoolAllocator<Comp>& getAllocator();
+  /// Creates a component of the given type from the allocator of the latter.
+  /// \tparam Comp Type of the component to be created.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param args Arguments to be forwarded to the component.
+  /// \return Created component.
+  template <typename Comp, typename... Args> static ComponentPtr create(Args&&... args);
 
   virtual ~Component() = default;
 
@@ -1,3 +1,4 @@
+#include <new>
 #include <type_traits>
 
 namespace Raz {
@@ -11,4 +12,42 @@ std::size_t Component::getId() {
   return id;
 }
 
+template <typename Comp>
+PoolAllocator<Comp>& Component::getAllocator() {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Allocated component must be derived from Component.");
+
+  // The allocator is voluntarily never destroyed, since components may be released during static destruction (for example by
+  //  a global World), possibly after the allocator itself would have been destroyed
+  static PoolAllocator<Comp>& allocator = *new PoolAllocator<Comp>();
+  return allocator;
+}
+
+template <typename Comp, typename... Args>
+ComponentPtr Component::create(Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Created component must be derived from Component.");
+
+  PoolAllocator<Comp>& allocator = getAllocator<Comp>();
+  Comp* component                = allocator.allocate();
+
+  try {
+    new (component) Comp(std::forward<Args>(args)...);
+  } catch (...) {
+    allocator.deallocate(component);
+    throw;
+  }
+
+  return ComponentPtr(component, ComponentDeleter{ [] (Component* comp) {
+    Comp* typedComp = static_cast<Comp*>(comp);
+    typedComp->~Comp();
+    getAllocator<Comp>().deallocate(typedComp);
+  } });
+}
+
+inline void ComponentDeleter::operator()(Component* component) const noexcept {
+  if (destroy)
+    destroy(component);
+  else
+    delete component;
+}
+
 } // namespace Raz
@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef RAZ_COMPONENTSTORAGE_HPP
+#define RAZ_COMPONENTSTORAGE_HPP
+
+#include "RaZ/Component.hpp"
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Raz {
+
+/// Way the components of a World's entities are stored.
+enum class ComponentStorageType {
+  PER_ENTITY, ///< Each entity owns its components, allocated separately.
+  DENSE       ///< Components are owned by the World, stored contiguously in one pool per component type.
+};
+
+/// Base class of the per-type component pools, allowing to handle them without knowing the actual component type.
+class BaseComponentPool {
+public:
+  BaseComponentPool(const BaseComponentPool&) = delete;
+  BaseComponentPool(BaseComponentPool&&) noexcept = delete;
+
+  /// Gets the number of components stored in the pool.
+  /// \return Component count.
+  std::size_t getSize() const noexcept { return m_entityIndices.size(); }
+  /// Gets the indices of the entities owning the stored components, in the order in which those are stored.
+  /// \return Owner entities' indices.
+  const std::vector<std::size_t>& getEntityIndices() const noexcept { return m_entityIndices; }
+
+  /// Checks if the pool holds a component for the given entity.
+  /// \param entityIndex Index of the entity to be checked.
+  /// \return True if a component exists for the entity, false otherwise.
+  bool contains(std::size_t entityIndex) const noexcept {
+    return (entityIndex < m_denseIndices.size() && m_denseIndices[entityIndex] != InvalidIndex);
+  }
+  /// Removes the component held by the given entity, if any.
+  /// \param entityIndex Index of the entity whose component is to be removed.
+  virtual void remove(std::size_t entityIndex) = 0;
+
+  BaseComponentPool& operator=(const BaseComponentPool&) = delete;
+  BaseComponentPool& operator=(BaseComponentPool&&) noexcept = delete;
+
+  virtual ~BaseComponentPool() = default;
+
+protected:
+  static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+  BaseComponentPool() = default;
+
+  std::vector<std::size_t> m_entityIndices {}; ///< Owner entity index of each stored component.
+  std::vector<std::size_t> m_denseIndices {}; ///< Storage index of each entity's component, or InvalidIndex if it has none.
+};
+
+/// Sparse set storing components of a single type contiguously.
+/// Components are allocated in fixed-size pages, so that adding one never moves the others. Removing a component
+///   moves the last one of the pool into the freed slot to keep the storage packed; references to components of this type
+///   may thus be invalidated by a removal.
+/// \tparam Comp Type of the components to be stored.
+template <typename Comp>
+class ComponentPool final : public BaseComponentPool {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Pooled component must be derived from Component.");
+  static_assert(std::is_move_constructible_v<Comp>, "Error: Pooled component must be move constructible.");
+
+public:
+  static constexpr std::size_t PageSize = 1024; ///< Number of components allocated at once.
+
+  ComponentPool() = default;
+
+  /// Gets the component held by the given entity. The entity must have a component in this pool.
+  /// \param entityIndex Index of the entity to get the component from.
+  /// \return Reference to the found component.
+  const Comp& get(std::size_t entityIndex) const noexcept;
+  /// Gets the component held by the given entity. The entity must have a component in this pool.
+  /// \param entityIndex Index of the entity to get the component from.
+  /// \return Reference to the found component.
+  Comp& get(std::size_t entityIndex) noexcept { return const_cast<Comp&>(static_cast<const ComponentPool*>(this)->get(entityIndex)); }
+  /// Gets the component stored at the given position, in the same order as getEntityIndices().
+  /// \param storageIndex Position of the component in the pool.
+  /// \return Reference to the component.
+  const Comp& getAt(std::size_t storageIndex) const noexcept;
+  /// Gets the component stored at the given position, in the same order as getEntityIndices().
+  /// \param storageIndex Position of the component in the pool.
+  /// \return Reference to the component.
+  Comp& getAt(std::size_t storageIndex) noexcept { return const_cast<Comp&>(static_cast<const ComponentPool*>(this)->getAt(storageIndex)); }
+  /// Constructs a component for the given entity. If the entity already has one, it is replaced.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param entityIndex Index of the entity owning the component.
+  /// \param args Arguments to be forwarded to the component.
+  /// \return Reference to the newly constructed component.
+  template <typename... Args> Comp& emplace(std::size_t entityIndex, Args&&... args);
+  void remove(std::size_t entityIndex) override;
+
+  ~ComponentPool() override;
+
+private:
+  using ComponentSlot = std::aligned_storage_t<sizeof(Comp), alignof(Comp)>;
+  using Page          = std::array<ComponentSlot, PageSize>;
+
+  ComponentSlot& getSlot(std::size_t storageIndex) const noexcept { return (*m_pages[storageIndex / PageSize])[storageIndex % PageSize]; }
+
+  std::vector<std::unique_ptr<Page>> m_pages {};
+};
+
+/// Holds the component pools of a World using dense component storage, one for each component type.
+class ComponentStorage {
+public:
+  ComponentStorage() = default;
+  ComponentStorage(const ComponentStorage&) = delete;
+  ComponentStorage(ComponentStorage&&) noexcept = default;
+
+  /// Checks if a pool exists for the given component type.
+  /// \tparam Comp Type of the component to check the pool for.
+  /// \return True if the pool exists, false otherwise.
+  template <typename Comp> bool hasPool() const noexcept;
+  /// Gets the pool of the given component type. This pool must exist.
+  /// \tparam Comp Type of the component to get the pool of.
+  /// \return Constant reference to the pool.
+  template <typename Comp> const ComponentPool<Comp>& getPool() const noexcept;
+  /// Gets the pool of the given component type, creating it if it does not exist yet.
+  /// \tparam Comp Type of the component to get the pool of.
+  /// \return Reference to the pool.
+  template <typename Comp> ComponentPool<Comp>& getPool();
+  /// Removes the component of the given ID held by an entity, if any.
+  /// \param componentId ID of the component to be removed.
+  /// \param entityIndex Index of the entity owning the component.
+  void removeComponent(std::size_t componentId, std::size_t entityIndex);
+
+  ComponentStorage& operator=(const ComponentStorage&) = delete;
+  ComponentStorage& operator=(ComponentStorage&&) noexcept = default;
+
+private:
+  std::vector<std::unique_ptr<BaseComponentPool>> m_pools {};
+};
+
+} // namespace Raz
+
+#include "RaZ/ComponentStorage.inl"
+
+#endif // RAZ_COMPONENTSTORAGE_HPP
@@ -0,0 +1,101 @@
+#include <cassert>
+#include <new>
+
+namespace Raz {
+
+template <typename Comp>
+const Comp& ComponentPool<Comp>::get(std::size_t entityIndex) const noexcept {
+  assert("Error: The entity has no component in this pool." && contains(entityIndex));
+  return getAt(m_denseIndices[entityIndex]);
+}
+
+template <typename Comp>
+const Comp& ComponentPool<Comp>::getAt(std::size_t storageIndex) const noexcept {
+  assert("Error: The requested component is out of bounds." && storageIndex < m_entityIndices.size());
+  return *std::launder(reinterpret_cast<const Comp*>(&getSlot(storageIndex)));
+}
+
+template <typename Comp>
+template <typename... Args>
+Comp& ComponentPool<Comp>::emplace(std::size_t entityIndex, Args&&... args) {
+  if (contains(entityIndex)) {
+    Comp& component = get(entityIndex);
+    component.~Comp();
+
+    return *new (&component) Comp(std::forward<Args>(args)...);
+  }
+
+  const std::size_t storageIndex = m_entityIndices.size();
+
+  if (storageIndex == m_pages.size() * PageSize)
+    m_pages.emplace_back(std::make_unique<Page>());
+
+  Comp* component = new (&getSlot(storageIndex)) Comp(std::forward<Args>(args)...);
+
+  if (entityIndex >= m_denseIndices.size())
+    m_denseIndices.resize(entityIndex + 1, InvalidIndex);
+
+  m_denseIndices[entityIndex] = storageIndex;
+  m_entityIndices.emplace_back(entityIndex);
+
+  return *component;
+}
+
+template <typename Comp>
+void ComponentPool<Comp>::remove(std::size_t entityIndex) {
+  if (!contains(entityIndex))
+    return;
+
+  const std::size_t storageIndex = m_denseIndices[entityIndex];
+  const std::size_t lastIndex    = m_entityIndices.size() - 1;
+
+  Comp& component = getAt(storageIndex);
+  component.~Comp();
+
+  // Moving the last component into the freed slot, so that the storage remains packed
+  if (storageIndex != lastIndex) {
+    Comp& lastComponent = getAt(lastIndex);
+    new (&component) Comp(std::move(lastComponent));
+    lastComponent.~Comp();
+
+    const std::size_t lastEntityIndex = m_entityIndices[lastIndex];
+    m_entityIndices[storageIndex]     = lastEntityIndex;
+    m_denseIndices[lastEntityIndex]   = storageIndex;
+  }
+
+  m_entityIndices.pop_back();
+  m_denseIndices[entityIndex] = InvalidIndex;
+}
+
+template <typename Comp>
+ComponentPool<Comp>::~ComponentPool() {
+  for (std::size_t storageIndex = 0; storageIndex < m_entityIndices.size(); ++storageIndex)
+    getAt(storageIndex).~Comp();
+}
+
+template <typename Comp>
+bool ComponentStorage::hasPool() const noexcept {
+  const std::size_t compId = Component::getId<Comp>();
+  return (compId < m_pools.size() && m_pools[compId]);
+}
+
+template <typename Comp>
+const ComponentPool<Comp>& ComponentStorage::getPool() const noexcept {
+  assert("Error: No pool exists for the requested component type." && hasPool<Comp>());
+  return static_cast<const ComponentPool<Comp>&>(*m_pools[Component::getId<Comp>()]);
+}
+
+template <typename Comp>
+ComponentPool<Comp>& ComponentStorage::getPool() {
+  const std::size_t compId = Component::getId<Comp>();
+
+  if (compId >= m_pools.size())
+    m_pools.resize(compId + 1);
+
+  if (!m_pools[compId])
+    m_pools[compId] = std::make_unique<ComponentPool<Comp>>();
+
+  return static_cast<ComponentPool<Comp>&>(*m_pools[compId]);
+}
+
+} // namespace Raz
@@ -4,8 +4,11 @@
 #define RAZ_ENTITY_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/ComponentStorage.hpp"
 #include "RaZ/Utils/Bitset.hpp"
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -15,15 +18,45 @@ namespace Raz {
 class Entity;
 using EntityPtr = std::unique_ptr<Entity>;
 
+class World;
+
+/// Generational handle to an entity, which can safely be kept after the entity has been removed from its world.
+/// An entity's index may be given to a new entity once the former is removed; the generation, incremented on each removal,
+///   allows the world to detect that a handle refers to a previous entity.
+struct EntityHandle {
+  std::size_t index = std::numeric_limits<std::size_t>::max();
+  uint32_t generation = 0;
+
+  bool operator==(const EntityHandle& handle) const noexcept { return (index == handle.index && generation == handle.generation); }
+  bool operator!=(const EntityHandle& handle) const noexcept { return !(*this == handle); }
+};
+
 /// Entity class representing an aggregate of Component objects.
 class Entity {
+  friend World;
+  template <typename... Comps> friend class EntityView;
+
 public:
-  explicit Entity(std::size_t index, bool enabled = true) : m_id{ index }, m_enabled{ enabled } {}
+  /// Creates an entity.
+  /// \param index Index of the entity.
+  /// \param enabled True if the entity should be active immediately, false otherwise.
+  /// \param componentStorage Dense storage in which the entity's components will be placed; nullptr if the entity owns them itself.
+  explicit Entity(std::size_t index, bool enabled = true, ComponentStorage* componentStorage = nullptr)
+    : m_id{ index }, m_enabled{ enabled }, m_componentStorage{ componentStorage } {}
   Entity(const Entity&) = delete;
   Entity(Entity&&) noexcept = delete;
 
   std::size_t getId() const { return m_id; }
+  /// Gets the generation of the entity's index, which is incremented each time an entity holding this index is removed.
+  /// \return Entity's generation.
+  uint32_t getGeneration() const noexcept { return m_generation; }
+  /// Gets a generational handle to the entity, allowing to check later whether the entity still exists.
+  /// \return Entity's handle.
+  EntityHandle getHandle() const noexcept { return EntityHandle{ m_id, m_generation }; }
   bool isEnabled() const { return m_enabled; }
+  /// Gets the components owned by the entity.
+  /// \note If the entity's components are placed in a dense storage, they are held by the latter & this list is empty.
+  /// \return Entity's components, indexed by their ID.
   const std::vector<ComponentPtr>& getComponents() const { return m_components; }
   const Bitset& getEnabledComponents() const { return m_enabledComponents; }
 
@@ -65,21 +98,35 @@ public:
   /// Changes the entity's enabled state.
   /// Enables or disables the entity according to the given parameter.
   /// \param enabled True if the entity should be enabled, false if it should be disabled.
-  void enable(bool enabled = true) { m_enabled = enabled; }
+  void enable(bool enabled = true);
   /// Disables the entity.
   void disable() { enable(false); }
 
   Entity& operator=(const Entity&) = delete;
   Entity& operator=(Entity&&) noexcept = delete;
 
+  ~Entity();
+
 protected:
   Entity() = default;
 
 private:
+  /// Gets a given component held by the entity, without checking for its existence.
+  /// \tparam Comp Type of the component to be fetched.
+  /// \return Reference to the component.
+  template <typename Comp> Comp& getComponentUnchecked();
+  /// Notifies the world owning the entity that its components or enabled state have changed.
+  /// \param enabledStateChanged True if the entity has been enabled or disabled, false if its components have changed.
+  void notifyWorld(bool enabledStateChanged = false);
+
   std::size_t m_id {};
+  uint32_t m_generation {};
   bool m_enabled {};
   std::vector<ComponentPtr> m_components {};
   Bitset m_enabledComponents {};
+  ComponentStorage* m_componentStorage {};
+  World* m_world {}; ///< World owning the entity, if any.
+  bool m_isDirty {}; ///< Whether the entity has changed since its owning world has last been refreshed.
 };
 
 } // namespace Raz
@@ -5,15 +5,19 @@ bool Entity::hasComponent() const {
   static_assert(std::is_base_of_v<Component, Comp>, "Error: Checked component must be derived from Component.");
 
   const std::size_t compId = Component::getId<Comp>();
-  return ((compId < m_components.size()) && m_enabledComponents[compId]);
+  return ((compId < m_enabledComponents.getSize()) && m_enabledComponents[compId]);
 }
 
 template <typename Comp>
 const Comp& Entity::getComponent() const {
   static_assert(std::is_base_of_v<Component, Comp>, "Error: Fetched component must be derived from Component.");
 
-  if (hasComponent<Comp>())
+  if (hasComponent<Comp>()) {
+    if (m_componentStorage)
+      return m_componentStorage->getPool<Comp>().get(m_id);
+
     return static_cast<const Comp&>(*m_components[Component::getId<Comp>()]);
+  }
 
   throw std::runtime_error("Error: No component available of specified type");
 }
@@ -24,11 +28,20 @@ Comp& Entity::addComponent(Args&&... args) {
 
   const std::size_t compId = Component::getId<Comp>();
 
+  if (m_componentStorage) {
+    Comp& component = m_componentStorage->getPool<Comp>().emplace(m_id, std::forward<Args>(args)...);
+    m_enabledComponents.setBit(compId);
+    notifyWorld();
+
+    return component;
+  }
+
   if (compId >= m_components.size())
     m_components.resize(compId + 1);
 
-  m_components[compId] = std::make_unique<Comp>(std::forward<Args>(args)...);
+  m_components[compId] = Component::create<Comp>(std::forward<Args>(args)...);
   m_enabledComponents.setBit(compId);
+  notifyWorld();
 
   return static_cast<Comp&>(*m_components[compId]);
 }
@@ -54,9 +67,22 @@ void Entity::removeComponent() {
   if (hasComponent<Comp>()) {
     const std::size_t compId = Component::getId<Comp>();
 
-    m_components[compId].reset();
+    if (m_componentStorage)
+      m_componentStorage->getPool<Comp>().remove(m_id);
+    else
+      m_components[compId].reset();
+
     m_enabledComponents.setBit(compId, false);
+    notifyWorld();
   }
 }
 
+template <typename Comp>
+Comp& Entity::getComponentUnchecked() {
+  if (m_componentStorage)
+    return m_componentStorage->getPool<Comp>().get(m_id);
+
+  return static_cast<Comp&>(*m_components[Component::getId<Comp>()]);
+}
+
 } // namespace Raz
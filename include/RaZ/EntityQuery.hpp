@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef RAZ_ENTITYQUERY_HPP
+#define RAZ_ENTITYQUERY_HPP
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/Utils/Bitset.hpp"
+
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace Raz {
+
+/// Cached set of the enabled entities holding at least all of the given components.
+/// The set is kept up to date by the World owning it whenever an entity's components or enabled state change.
+class EntityQuery {
+public:
+  /// Creates a query matching the entities holding all the given components.
+  /// \param components Components an entity must hold to be matched.
+  explicit EntityQuery(Bitset components) : m_components{ std::move(components) } {}
+  EntityQuery(const EntityQuery&) = delete;
+  EntityQuery(EntityQuery&&) noexcept = default;
+
+  const Bitset& getComponents() const noexcept { return m_components; }
+  const std::vector<Entity*>& getEntities() const noexcept { return m_entities; }
+
+  /// Checks if the given entity should be part of the query's results.
+  /// \param entity Entity to be checked.
+  /// \return True if the entity is enabled & holds all the query's components, false otherwise.
+  bool matches(const Entity& entity) const;
+  /// Checks if the given entity is part of the query's results.
+  /// \param entity Entity to be checked.
+  /// \return True if the entity is contained by the query, false otherwise.
+  bool contains(const Entity& entity) const noexcept {
+    return (entity.getId() < m_entityPositions.size() && m_entityPositions[entity.getId()] != InvalidPosition);
+  }
+  /// Adds or removes the given entity from the query's results according to its current state.
+  /// \param entity Entity to be updated.
+  void update(Entity& entity);
+  /// Removes the given entity from the query's results, if present.
+  /// \param entity Entity to be removed.
+  void remove(const Entity& entity);
+  /// Removes all the entities from the query's results.
+  void clear() noexcept;
+
+  EntityQuery& operator=(const EntityQuery&) = delete;
+  EntityQuery& operator=(EntityQuery&&) noexcept = default;
+
+private:
+  static constexpr std::size_t InvalidPosition = std::numeric_limits<std::size_t>::max();
+
+  Bitset m_components {};
+  std::vector<Entity*> m_entities {};
+  std::vector<std::size_t> m_entityPositions {}; ///< Position of each entity in the results, indexed by the entity's ID.
+};
+
+/// Typed view over the entities matched by an EntityQuery, giving direct access to their components.
+/// \tparam Comps Types of the components to be accessed.
+template <typename... Comps>
+class EntityView {
+  static_assert(sizeof...(Comps) > 0, "Error: An entity view must access at least one component.");
+
+public:
+  class Iterator {
+  public:
+    explicit Iterator(std::vector<Entity*>::const_iterator entityIter) : m_entityIter{ entityIter } {}
+
+    Entity& getEntity() const noexcept { return **m_entityIter; }
+
+    std::tuple<Comps&...> operator*() const { return std::forward_as_tuple(getEntity().template getComponentUnchecked<Comps>()...); }
+    Iterator& operator++() noexcept { ++m_entityIter; return *this; }
+    bool operator==(const Iterator& iter) const noexcept { return (m_entityIter == iter.m_entityIter); }
+    bool operator!=(const Iterator& iter) const noexcept { return !(*this == iter); }
+
+  private:
+    std::vector<Entity*>::const_iterator m_entityIter;
+  };
+
+  explicit EntityView(const EntityQuery& query) noexcept : m_entities{ &query.getEntities() } {}
+
+  const std::vector<Entity*>& getEntities() const noexcept { return *m_entities; }
+  std::size_t getSize() const noexcept { return m_entities->size(); }
+  bool isEmpty() const noexcept { return m_entities->empty(); }
+
+  /// Calls the given function for each entity of the view.
+  /// \tparam Func Type of the function to be called.
+  /// \param func Function to be called, taking either references to the components, or the entity followed by them.
+  template <typename Func> void forEach(Func&& func) const;
+
+  Iterator begin() const noexcept { return Iterator(m_entities->cbegin()); }
+  Iterator end() const noexcept { return Iterator(m_entities->cend()); }
+
+private:
+  const std::vector<Entity*>* m_entities {};
+};
+
+} // namespace Raz
+
+#include "RaZ/EntityQuery.inl"
+
+#endif // RAZ_ENTITYQUERY_HPP
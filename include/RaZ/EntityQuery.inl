@@ -0,0 +1,14 @@
+namespace Raz {
+
+template <typename... Comps>
+template <typename Func>
+void EntityView<Comps...>::forEach(Func&& func) const {
+  for (Entity* entity : *m_entities) {
+    if constexpr (std::is_invocable_v<Func, Entity&, Comps&...>)
+      func(*entity, entity->getComponentUnchecked<Comps>()...);
+    else
+      func(entity->getComponentUnchecked<Comps>()...);
+  }
+}
+
+} // namespace Raz
@@ -1,4 +1,5 @@
 #include "RaZ/Utils/FloatUtils.hpp"
+#include "RaZ/Utils/SimdUtils.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -172,6 +173,152 @@ constexpr Mat4<T> computeMatrixInverse(const Mat4<T>& mat, T determinant) noexce
   return cofactors.transpose() / determinant;
 }
 
+// The following functions are the vectorized counterparts of the generic 4x4 float matrix operations. They cannot be evaluated
+//  at compile time, and must only be called when SimdUtils::canVectorize() returns true
+
+template <typename T>
+Mat4<T> computeMatrixProductVectorized(const Mat4<T>& mat1, const Mat4<T>& mat2) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float matrices can be multiplied with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  const Pack row0 = Pack::load(mat2.getDataPtr());
+  const Pack row1 = Pack::load(mat2.getDataPtr() + 4);
+  const Pack row2 = Pack::load(mat2.getDataPtr() + 8);
+  const Pack row3 = Pack::load(mat2.getDataPtr() + 12);
+
+  Mat4<T> res;
+
+  // Each resulting row is a combination of the second matrix's rows, weighted by the first matrix's row values
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    const T* weights = mat1.getDataPtr() + rowIndex * 4;
+    const Pack resRow = Pack(weights[0]) * row0 + Pack(weights[1]) * row1 + Pack(weights[2]) * row2 + Pack(weights[3]) * row3;
+    resRow.store(res.getDataPtr() + rowIndex * 4);
+  }
+
+  return res;
+}
+
+template <typename T>
+Vector<T, 4> computeMatrixVectorProductVectorized(const Mat4<T>& mat, const Vector<T, 4>& vec) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float matrices can be multiplied with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  const Pack vecPack = Pack::load(vec.getDataPtr());
+
+  Pack row0 = Pack::load(mat.getDataPtr()) * vecPack;
+  Pack row1 = Pack::load(mat.getDataPtr() + 4) * vecPack;
+  Pack row2 = Pack::load(mat.getDataPtr() + 8) * vecPack;
+  Pack row3 = Pack::load(mat.getDataPtr() + 12) * vecPack;
+
+  // Transposing the products makes each row's sum a vertical addition
+  transpose(row0, row1, row2, row3);
+
+  Vector<T, 4> res;
+  (row0 + row1 + row2 + row3).store(res.getDataPtr());
+  return res;
+}
+
+template <typename T>
+Mat4<T> computeMatrixTransposeVectorized(const Mat4<T>& mat) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float matrices can be transposed with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  Pack row0 = Pack::load(mat.getDataPtr());
+  Pack row1 = Pack::load(mat.getDataPtr() + 4);
+  Pack row2 = Pack::load(mat.getDataPtr() + 8);
+  Pack row3 = Pack::load(mat.getDataPtr() + 12);
+
+  transpose(row0, row1, row2, row3);
+
+  Mat4<T> res;
+  row0.store(res.getDataPtr());
+  row1.store(res.getDataPtr() + 4);
+  row2.store(res.getDataPtr() + 8);
+  row3.store(res.getDataPtr() + 12);
+  return res;
+}
+
+// Each 2x2 matrix is held in a pack as [ m00 m01 m10 m11 ]
+
+// Computes the product between two 2x2 matrices
+inline SimdUtils::FloatPack<4> computeMatrix2Product(const SimdUtils::FloatPack<4>& mat1, const SimdUtils::FloatPack<4>& mat2) noexcept {
+  using Pack = SimdUtils::FloatPack<4>;
+  return mat1 * Pack::shuffle<0, 3, 0, 3>(mat2, mat2) + Pack::shuffle<1, 0, 3, 2>(mat1, mat1) * Pack::shuffle<2, 1, 2, 1>(mat2, mat2);
+}
+
+// Computes the product between the adjugate of a 2x2 matrix & another one
+inline SimdUtils::FloatPack<4> computeMatrix2AdjugateProduct(const SimdUtils::FloatPack<4>& mat1, const SimdUtils::FloatPack<4>& mat2) noexcept {
+  using Pack = SimdUtils::FloatPack<4>;
+  return Pack::shuffle<3, 3, 0, 0>(mat1, mat1) * mat2 - Pack::shuffle<1, 1, 2, 2>(mat1, mat1) * Pack::shuffle<2, 3, 0, 1>(mat2, mat2);
+}
+
+// Computes the product between a 2x2 matrix & the adjugate of another one
+inline SimdUtils::FloatPack<4> computeMatrix2ProductAdjugate(const SimdUtils::FloatPack<4>& mat1, const SimdUtils::FloatPack<4>& mat2) noexcept {
+  using Pack = SimdUtils::FloatPack<4>;
+  return mat1 * Pack::shuffle<3, 0, 3, 0>(mat2, mat2) - Pack::shuffle<1, 0, 3, 2>(mat1, mat1) * Pack::shuffle<2, 1, 2, 1>(mat2, mat2);
+}
+
+template <typename T>
+Mat4<T> computeMatrixInverseVectorized(const Mat4<T>& mat) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float matrices can be inverted with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  const Pack row0 = Pack::load(mat.getDataPtr());
+  const Pack row1 = Pack::load(mat.getDataPtr() + 4);
+  const Pack row2 = Pack::load(mat.getDataPtr() + 8);
+  const Pack row3 = Pack::load(mat.getDataPtr() + 12);
+
+  // The matrix is split into four 2x2 blocks [ A B ; C D ], from which the inverse is computed blockwise
+  //  See: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+  const Pack blockA = Pack::shuffle<0, 1, 0, 1>(row0, row1);
+  const Pack blockB = Pack::shuffle<2, 3, 2, 3>(row0, row1);
+  const Pack blockC = Pack::shuffle<0, 1, 0, 1>(row2, row3);
+  const Pack blockD = Pack::shuffle<2, 3, 2, 3>(row2, row3);
+
+  // Determinants of the blocks, as [ |A| |B| |C| |D| ]
+  const Pack blockDeterms = Pack::shuffle<0, 2, 0, 2>(row0, row2) * Pack::shuffle<1, 3, 1, 3>(row1, row3)
+                          - Pack::shuffle<1, 3, 1, 3>(row0, row2) * Pack::shuffle<0, 2, 0, 2>(row1, row3);
+  const Pack determA = Pack::shuffle<0, 0, 0, 0>(blockDeterms, blockDeterms);
+  const Pack determB = Pack::shuffle<1, 1, 1, 1>(blockDeterms, blockDeterms);
+  const Pack determC = Pack::shuffle<2, 2, 2, 2>(blockDeterms, blockDeterms);
+  const Pack determD = Pack::shuffle<3, 3, 3, 3>(blockDeterms, blockDeterms);
+
+  const Pack adjDC = computeMatrix2AdjugateProduct(blockD, blockC);
+  const Pack adjAB = computeMatrix2AdjugateProduct(blockA, blockB);
+
+  // Adjugates of the resulting blocks [ X Y ; Z W ], which are yet to be divided by the determinant
+  const Pack adjX = determD * blockA - computeMatrix2Product(blockB, adjDC);
+  const Pack adjW = determA * blockD - computeMatrix2Product(blockC, adjAB);
+  const Pack adjY = determB * blockC - computeMatrix2ProductAdjugate(blockD, adjAB);
+  const Pack adjZ = determC * blockB - computeMatrix2ProductAdjugate(blockA, adjDC);
+
+  // |M| = |A| * |D| + |B| * |C| - tr((A#B)(D#C))
+  Pack trace = adjAB * Pack::shuffle<0, 2, 1, 3>(adjDC, adjDC);
+  trace = trace + Pack::shuffle<2, 3, 0, 1>(trace, trace);
+  trace = trace + Pack::shuffle<1, 0, 3, 2>(trace, trace);
+  const Pack determinant = determA * determD + determB * determC - trace;
+
+  constexpr std::array<float, 4> adjugateSigns = { 1.f, -1.f, -1.f, 1.f };
+  const Pack invDeterminant = Pack::load(adjugateSigns.data()) / determinant;
+
+  const Pack invX = adjX * invDeterminant;
+  const Pack invY = adjY * invDeterminant;
+  const Pack invZ = adjZ * invDeterminant;
+  const Pack invW = adjW * invDeterminant;
+
+  // Recovering the adjugates from the blocks while putting them back into rows
+  Mat4<T> res;
+  Pack::shuffle<3, 1, 3, 1>(invX, invY).store(res.getDataPtr());
+  Pack::shuffle<2, 0, 2, 0>(invX, invY).store(res.getDataPtr() + 4);
+  Pack::shuffle<3, 1, 3, 1>(invZ, invW).store(res.getDataPtr() + 8);
+  Pack::shuffle<2, 0, 2, 0>(invZ, invW).store(res.getDataPtr() + 12);
+  return res;
+}
+
 } // namespace
 
 template <typename T, std::size_t W, std::size_t H>
@@ -241,6 +388,11 @@ constexpr Matrix<T, W, H> Matrix<T, W, H>::identity() noexcept {
 
 template <typename T, std::size_t W, std::size_t H>
 constexpr Matrix<T, H, W> Matrix<T, W, H>::transpose() const noexcept {
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4) {
+    if (SimdUtils::canVectorize())
+      return computeMatrixTransposeVectorized(*this);
+  }
+
   Matrix<T, H, W> res;
 
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
@@ -262,6 +414,11 @@ template <typename T, std::size_t W, std::size_t H>
 constexpr Matrix<T, W, H> Matrix<T, W, H>::inverse() const noexcept(std::is_integral_v<T> || std::numeric_limits<T>::is_iec559) {
   static_assert(W == H, "Error: Matrix must be a square one.");
 
+  if constexpr (std::is_same_v<T, float> && W == 4) {
+    if (SimdUtils::canVectorize())
+      return computeMatrixInverseVectorized(*this);
+  }
+
   return computeMatrixInverse(*this, computeMatrixDeterminant(*this));
 }
 
@@ -363,6 +520,11 @@ constexpr Matrix<T, W, H> Matrix<T, W, H>::operator/(T val) const noexcept(std::
 
 template <typename T, std::size_t W, std::size_t H>
 constexpr Vector<T, H> Matrix<T, W, H>::operator*(const Vector<T, H>& vec) const noexcept {
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4) {
+    if (SimdUtils::canVectorize())
+      return computeMatrixVectorProductVectorized(*this, vec);
+  }
+
   // This multiplication is made assuming the vector to be vertical
   Vector<T, H> res {};
 
@@ -379,6 +541,11 @@ template <std::size_t WI, std::size_t HI>
 constexpr Matrix<T, H, WI> Matrix<T, W, H>::operator*(const Matrix<T, WI, HI>& mat) const noexcept {
   static_assert(W == HI, "Error: Input matrix's width must be equal to current matrix's height.");
 
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4 && WI == 4) {
+    if (SimdUtils::canVectorize())
+      return computeMatrixProductVectorized(*this, mat);
+  }
+
   Matrix<T, H, WI> res {};
 
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
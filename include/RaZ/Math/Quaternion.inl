@@ -1,7 +1,76 @@
 #include "RaZ/Math/Constants.hpp"
+#include "RaZ/Utils/SimdUtils.hpp"
 
 namespace Raz {
 
+namespace {
+
+// The following functions are the vectorized counterparts of the generic float quaternion operations. They cannot be evaluated
+//  at compile time, and must only be called when SimdUtils::canVectorize() returns true
+
+template <typename T>
+Quaternion<T> computeQuaternionProductVectorized(const Quaternion<T>& quat1, const Quaternion<T>& quat2) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float quaternions can be multiplied with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  // Components are packed as [ w x y z ]
+  const std::array<T, 4> values = { quat2.w(), quat2.x(), quat2.y(), quat2.z() };
+  const Pack wxyz = Pack::load(values.data());
+
+  constexpr std::array<float, 4> xSigns = { -1.f,  1.f, -1.f,  1.f };
+  constexpr std::array<float, 4> ySigns = { -1.f,  1.f,  1.f, -1.f };
+  constexpr std::array<float, 4> zSigns = { -1.f, -1.f,  1.f,  1.f };
+
+  const Pack res = Pack(quat1.w()) * wxyz
+                 + Pack(quat1.x()) * Pack::shuffle<1, 0, 3, 2>(wxyz, wxyz) * Pack::load(xSigns.data())
+                 + Pack(quat1.y()) * Pack::shuffle<2, 3, 0, 1>(wxyz, wxyz) * Pack::load(ySigns.data())
+                 + Pack(quat1.z()) * Pack::shuffle<3, 2, 1, 0>(wxyz, wxyz) * Pack::load(zSigns.data());
+
+  std::array<T, 4> resValues {};
+  res.store(resValues.data());
+  return Quaternion<T>(resValues[0], resValues[1], resValues[2], resValues[3]);
+}
+
+template <typename T>
+Mat4<T> computeQuaternionMatrixVectorized(const Quaternion<T>& quat) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float quaternions can be converted with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  // Components are packed as [ x y z w ]
+  const std::array<T, 4> values = { quat.x(), quat.y(), quat.z(), quat.w() };
+  const Pack xyzw      = Pack::load(values.data());
+  const Pack scaledXyz = xyzw * Pack(2 / quat.computeSquaredNorm());
+
+  // Computing [ xx yy zz _ ], [ xy yz xz _ ] & [ xw yw zw _ ] at once, all scaled by twice the inverse squared norm
+  std::array<T, 4> squares {};
+  std::array<T, 4> crosses {};
+  std::array<T, 4> reals {};
+  (scaledXyz * xyzw).store(squares.data());
+  (scaledXyz * Pack::shuffle<1, 2, 0, 3>(xyzw, xyzw)).store(crosses.data());
+  (scaledXyz * Pack::shuffle<3, 3, 3, 3>(xyzw, xyzw)).store(reals.data());
+
+  const T xx = squares[0];
+  const T yy = squares[1];
+  const T zz = squares[2];
+
+  const T xy = crosses[0];
+  const T yz = crosses[1];
+  const T xz = crosses[2];
+
+  const T xw = reals[0];
+  const T yw = reals[1];
+  const T zw = reals[2];
+
+  return Mat4<T>(1 - yy - zz,       xy - zw,           xz + yw,           static_cast<T>(0),
+                 xy + zw,           1 - xx - zz,       yz - xw,           static_cast<T>(0),
+                 xz - yw,           yz + xw,           1 - xx - yy,       static_cast<T>(0),
+                 static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+}
+
+} // namespace
+
 template <typename T>
 constexpr Quaternion<T>::Quaternion(Radians<T> angle, const Vec3<T>& axis) noexcept {
   const T halfAngle = angle.value / 2;
@@ -100,6 +169,11 @@ constexpr Quaternion<T> Quaternion<T>::inverse() const noexcept {
 
 template <typename T>
 constexpr Mat4<T> Quaternion<T>::computeMatrix() const noexcept(std::is_integral_v<T> || std::numeric_limits<T>::is_iec559) {
+  if constexpr (std::is_same_v<T, float>) {
+    if (SimdUtils::canVectorize())
+      return computeQuaternionMatrixVectorized(*this);
+  }
+
   const T invSqNorm = 1 / computeSquaredNorm();
 
   const T xx = (2 * m_complexes.x() * m_complexes.x()) * invSqNorm;
@@ -131,6 +205,13 @@ constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion& quat) const n
 
 template <typename T>
 constexpr Quaternion<T>& Quaternion<T>::operator*=(const Quaternion& quat) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    if (SimdUtils::canVectorize()) {
+      *this = computeQuaternionProductVectorized(*this, quat);
+      return *this;
+    }
+  }
+
   const Quaternion<T> res = *this;
 
   m_real = res.m_real          * quat.m_real
@@ -11,15 +11,29 @@
 namespace Raz {
 
 /// Transform class which handles 3D transformations (translation/rotation/scale).
+/// The local transformation matrix is cached & recomputed only when the transform changes; if the transform has a parent in a
+///   TransformSystem's hierarchy, its world matrix is cached as well, & is recomputed by the latter only when needed.
 class Transform final : public Component {
+  friend class TransformSystem;
+
 public:
   explicit Transform(const Vec3f& position = Vec3f(0.f), const Quaternionf& rotation = Quaternionf::identity(), const Vec3f& scale = Vec3f(1.f))
-    : m_position{ position }, m_rotation{ rotation }, m_scale{ scale } {}
+    : m_position{ position }, m_rotation{ rotation }, m_scale{ scale }, m_localMatrix{ computeTransformMatrix() } {}
 
   const Vec3f& getPosition() const { return m_position; }
   const Quaternionf& getRotation() const { return m_rotation; }
   const Vec3f& getScale() const { return m_scale; }
   bool hasUpdated() const { return m_updated; }
+  /// Gets the cached transformation matrix, relative to the transform's parent if any.
+  /// \return Local transformation matrix.
+  const Mat4f& getLocalMatrix() const noexcept { return m_localMatrix; }
+  /// Gets the cached transformation matrix in world space, combining the local one with those of the transform's parents.
+  /// If the transform has no parent, this is the local matrix.
+  /// \return World transformation matrix.
+  const Mat4f& getWorldMatrix() const noexcept { return (m_hasParent ? m_worldMatrix : m_localMatrix); }
+  /// Checks if the transform has a parent in a TransformSystem's hierarchy.
+  /// \return True if the transform has a parent, false otherwise.
+  bool hasParent() const noexcept { return m_hasParent; }
 
   void setPosition(const Vec3f& position);
   void setPosition(float x, float y, float z) { setPosition(Vec3f(x, y, z)); }
@@ -80,14 +94,23 @@ public:
   Mat4f computeTranslationMatrix(bool reverseTranslation = false) const;
   /// Computes the transformation matrix.
   /// This matrix combines all three features: translation, rotation & scale.
+  /// \note The result is already cached; getLocalMatrix() should be preferred.
   /// \return Transformation matrix.
   Mat4f computeTransformMatrix() const;
 
 private:
+  /// Recomputes the cached local matrix & marks the transform as updated.
+  void updateLocalMatrix();
+
   Vec3f m_position {};
   Quaternionf m_rotation = Quaternionf::identity();
   Vec3f m_scale = Vec3f(1.f);
   bool m_updated = true;
+
+  Mat4f m_localMatrix = Mat4f::identity();
+  Mat4f m_worldMatrix = Mat4f::identity(); ///< Matrix in world space, only valid if the transform has a parent.
+  bool m_hasParent = false;
+  bool m_isWorldMatrixDirty = true; ///< True if the local matrix has changed since the hierarchy's last update.
 };
 
 } // namespace Raz
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef RAZ_TRANSFORMSYSTEM_HPP
+#define RAZ_TRANSFORMSYSTEM_HPP
+
+#include "RaZ/System.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace Raz {
+
+class Transform;
+
+/// TransformSystem class, handling the parent/child hierarchy between the entities' transforms.
+/// Only the entities having a parent or children are processed: their world matrices are recomputed on each update, traversing
+///   the hierarchy breadth-first so that parents are always processed before their children; only the transforms which have
+///   changed & their descendants are recomputed. Transforms which are not part of any hierarchy are never processed.
+class TransformSystem final : public System {
+public:
+  TransformSystem();
+
+  /// Gets the number of entities being part of the hierarchy, either as a parent or as a child.
+  /// \return Number of nodes in the hierarchy.
+  std::size_t getNodeCount() const noexcept { return m_nodes.size(); }
+
+  /// Gets the parent of the given entity.
+  /// \param child Entity to get the parent of.
+  /// \return Pointer to the parent entity, or nullptr if the entity has no parent.
+  Entity* getParent(const Entity& child) const;
+  /// Gets the children of the given entity.
+  /// \param parent Entity to get the children of.
+  /// \return Handles of the child entities. Some may refer to entities removed since the last update.
+  const std::vector<EntityHandle>& getChildren(const Entity& parent) const;
+  /// Sets the parent of the given entity, whose transform will then be relative to its parent's. Both entities must belong
+  ///   to the system's world & have a Transform component, & the parent must not be a descendant of the child.
+  /// If the parent or the child are removed, or if their Transform component is, the link is broken on the next update.
+  /// \note This function must not be called while the systems are being updated concurrently.
+  /// \param child Entity to be attached to the parent.
+  /// \param parent Entity to attach the child to.
+  void setParent(Entity& child, const Entity& parent);
+  /// Detaches the given entity from its parent, if any; its transform then becomes relative to the world.
+  /// \note This function must not be called while the systems are being updated concurrently.
+  /// \param child Entity to be detached.
+  void removeParent(Entity& child);
+  /// Updates the world matrices of the transforms having changed in the hierarchy, as well as those of their descendants.
+  /// \return True, the system always remaining active.
+  bool update(float) override;
+
+private:
+  /// Links of an entity with its parent & children, indexed by the entity's ID.
+  struct HierarchyLink {
+    EntityHandle entity {};
+    EntityHandle parent {};
+    std::vector<EntityHandle> children {};
+  };
+
+  /// Fetches the link of the given entity, creating it if it does not exist yet.
+  /// \param entity Entity to get the link of.
+  /// \return Reference to the entity's link.
+  HierarchyLink& fetchLink(const Entity& entity);
+  /// Finds the transform of the entity referred to by the given handle.
+  /// \param handle Handle of the entity to get the transform of.
+  /// \return Pointer to the entity's transform, or nullptr if the entity or its transform has been removed.
+  Transform* findTransform(const EntityHandle& handle) const;
+  /// Removes the links referring to entities which no longer exist or have no transform, then rebuilds the flat breadth-first
+  ///   list of the hierarchy's nodes.
+  void rebuildHierarchy();
+
+  static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+  std::vector<HierarchyLink> m_links {};
+  bool m_isHierarchyDirty = false;
+
+  // Hierarchy's nodes, in breadth-first order
+  std::vector<EntityHandle> m_nodes {};
+  std::vector<std::size_t> m_nodeParents {}; ///< Index of each node's parent in the list, InvalidIndex if the node is a root.
+  std::vector<Transform*> m_nodeTransforms {}; ///< Transform of each node, only valid during an update.
+  std::vector<uint8_t> m_changedNodes {}; ///< Whether each node's world matrix has been recomputed during the current update.
+};
+
+} // namespace Raz
+
+#endif // RAZ_TRANSFORMSYSTEM_HPP
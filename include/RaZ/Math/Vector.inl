@@ -1,4 +1,5 @@
 #include "RaZ/Utils/FloatUtils.hpp"
+#include "RaZ/Utils/SimdUtils.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -6,6 +7,38 @@
 
 namespace Raz {
 
+namespace {
+
+// The following functions are the vectorized counterparts of the generic 4D float vector operations. They cannot be evaluated
+//  at compile time, and must only be called when SimdUtils::canVectorize() returns true
+
+template <typename T, typename OpT>
+void applyVectorized(Vector<T, 4>& vec1, const Vector<T, 4>& vec2, OpT&& operation) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float vectors can be computed with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+  operation(Pack::load(vec1.getDataPtr()), Pack::load(vec2.getDataPtr())).store(vec1.getDataPtr());
+}
+
+template <typename T>
+Vector<T, 4> computeVectorMatrixProductVectorized(const Vector<T, 4>& vec, const Matrix<T, 4, 4>& mat) noexcept {
+  static_assert(std::is_same_v<T, float>, "Error: Only float vectors can be multiplied with vectorized operations.");
+
+  using Pack = SimdUtils::FloatPack<4>;
+
+  // The resulting vector is a combination of the matrix's rows, weighted by the vector's values
+  const Pack res = Pack(vec[0]) * Pack::load(mat.getDataPtr())
+                 + Pack(vec[1]) * Pack::load(mat.getDataPtr() + 4)
+                 + Pack(vec[2]) * Pack::load(mat.getDataPtr() + 8)
+                 + Pack(vec[3]) * Pack::load(mat.getDataPtr() + 12);
+
+  Vector<T, 4> resVec;
+  res.store(resVec.getDataPtr());
+  return resVec;
+}
+
+} // namespace
+
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size>::Vector(const Vector<T, Size + 1>& vec) noexcept {
   for (std::size_t i = 0; i < Size; ++i)
@@ -182,6 +215,11 @@ constexpr Vector<T, Size> Vector<T, Size>::operator/(T val) const noexcept(std::
 template <typename T, std::size_t Size>
 template <std::size_t H>
 constexpr Vector<T, Size> Vector<T, Size>::operator*(const Matrix<T, Size, H>& mat) const noexcept {
+  if constexpr (std::is_same_v<T, float> && Size == 4 && H == 4) {
+    if (SimdUtils::canVectorize())
+      return computeVectorMatrixProductVectorized(*this, mat);
+  }
+
   // This multiplication is made assuming the vector to be horizontal
   Vector<T, Size> res {};
 
@@ -195,6 +233,13 @@ constexpr Vector<T, Size> Vector<T, Size>::operator*(const Matrix<T, Size, H>& m
 
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size>& Vector<T, Size>::operator+=(const Vector& vec) noexcept {
+  if constexpr (std::is_same_v<T, float> && Size == 4) {
+    if (SimdUtils::canVectorize()) {
+      applyVectorized(*this, vec, [] (const auto& pack1, const auto& pack2) { return pack1 + pack2; });
+      return *this;
+    }
+  }
+
   for (std::size_t i = 0; i < Size; ++i)
     m_data[i] += vec[i];
   return *this;
@@ -209,6 +254,13 @@ constexpr Vector<T, Size>& Vector<T, Size>::operator+=(T val) noexcept {
 
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size>& Vector<T, Size>::operator-=(const Vector& vec) noexcept {
+  if constexpr (std::is_same_v<T, float> && Size == 4) {
+    if (SimdUtils::canVectorize()) {
+      applyVectorized(*this, vec, [] (const auto& pack1, const auto& pack2) { return pack1 - pack2; });
+      return *this;
+    }
+  }
+
   for (std::size_t i = 0; i < Size; ++i)
     m_data[i] -= vec[i];
   return *this;
@@ -223,6 +275,13 @@ constexpr Vector<T, Size>& Vector<T, Size>::operator-=(T val) noexcept {
 
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size>& Vector<T, Size>::operator*=(const Vector& vec) noexcept {
+  if constexpr (std::is_same_v<T, float> && Size == 4) {
+    if (SimdUtils::canVectorize()) {
+      applyVectorized(*this, vec, [] (const auto& pack1, const auto& pack2) { return pack1 * pack2; });
+      return *this;
+    }
+  }
+
   for (std::size_t i = 0; i < Size; ++i)
     m_data[i] *= vec[i];
   return *this;
@@ -237,6 +296,13 @@ constexpr Vector<T, Size>& Vector<T, Size>::operator*=(T val) noexcept {
 
 template <typename T, std::size_t Size>
 constexpr Vector<T, Size>& Vector<T, Size>::operator/=(const Vector& vec) noexcept(std::is_integral_v<T> || std::numeric_limits<T>::is_iec559) {
+  if constexpr (std::is_same_v<T, float> && Size == 4) {
+    if (SimdUtils::canVectorize()) {
+      applyVectorized(*this, vec, [] (const auto& pack1, const auto& pack2) { return pack1 / pack2; });
+      return *this;
+    }
+  }
+
   for (std::size_t i = 0; i < Size; ++i)
     m_data[i] /= vec[i];
   return *this;
@@ -6,32 +6,47 @@
 #include "RaZ/Component.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <variant>
+
 namespace Raz {
 
+/// Collider component, holding a shape by value.
+/// Intersection checks between colliders are dispatched through a table indexed by both shapes' types, calling directly the
+///   concrete shapes' functions instead of going through virtual calls.
 class Collider final : public Component {
 public:
-  explicit Collider(Shape&& shape) { setShape(std::move(shape)); }
+  /// Shapes a collider can hold, in the same order as the ShapeType enumeration.
+  using ShapeVariant = std::variant<Line, Plane, Sphere, Triangle, Quad, AABB, OBB>;
+
+  explicit Collider(Shape&& shape) : m_shape{ createShape(std::move(shape)) } {}
   Collider(const Collider&) = delete;
   Collider(Collider&&) noexcept = default;
 
-  ShapeType getShapeType() const noexcept { return m_shapeType; }
-  const Shape& getShape() const noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
-  Shape& getShape() noexcept { assert("Error: No collider shape defined." && m_colliderShape); return *m_colliderShape; }
+  ShapeType getShapeType() const noexcept { return static_cast<ShapeType>(m_shape.index()); }
+  const Shape& getShape() const noexcept;
+  Shape& getShape() noexcept { return const_cast<Shape&>(static_cast<const Collider*>(this)->getShape()); }
   template <typename ShapeT> const ShapeT& getShape() const noexcept;
   template <typename ShapeT> ShapeT& getShape() noexcept { return const_cast<ShapeT&>(static_cast<const Collider*>(this)->getShape<ShapeT>()); }
 
-  void setShape(Shape&& shape);
+  void setShape(Shape&& shape) { m_shape = createShape(std::move(shape)); }
 
-  bool intersects(const Collider& collider) const { return intersects(*collider.m_colliderShape); }
+  bool intersects(const Collider& collider) const;
   bool intersects(const Shape& shape) const;
   bool intersects(const Ray& ray, RayHit* hit = nullptr) const;
+  /// Computes the bounding box of the collider's shape, without any virtual call.
+  /// \return Shape's bounding box.
+  AABB computeBoundingBox() const;
 
   Collider& operator=(const Collider&) = delete;
   Collider& operator=(Collider&&) noexcept = default;
 
 private:
-  ShapeType m_shapeType {};
-  std::unique_ptr<Shape> m_colliderShape {};
+  /// Moves the given shape into a variant holding its concrete type.
+  /// \param shape Shape to be moved.
+  /// \return Variant holding the shape.
+  static ShapeVariant createShape(Shape&& shape);
+
+  ShapeVariant m_shape;
 };
 
 } // namespace Raz
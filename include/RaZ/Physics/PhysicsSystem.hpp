@@ -5,29 +5,267 @@
 
 #include "RaZ/System.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Physics/SweepAndPrune.hpp"
+#include "RaZ/Utils/Bvh.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
 
 namespace Raz {
 
+class Collider;
+class RigidBody;
+class Transform;
+struct SweepHit;
+
+/// Hit of a ray cast against the physics system's colliders, giving the entity owning the collider that has been hit.
+struct RaycastHit {
+  Entity* entity {}; ///< Entity hit by the ray; nullptr if none has been.
+  RayHit rayHit {};
+};
+
+/// PhysicsSystem class, integrating the rigid bodies & resolving their collisions with the colliders.
+/// The contacts found at each step are all solved together by an iterative solver, applying impulses between the bodies. They are
+///   split into batches sharing no body, each batch being solved in parallel; the impulses are kept from one step to the next,
+///   so that the solver starts from the previous solution.
+/// Bodies in contact with each other are grouped into islands; once all the bodies of an island have been resting for long enough,
+///   they are put to sleep & skipped until woken up by a contact with an awake body, an impulse or a change of velocity.
+/// Rays can be cast against the colliders, which are kept in a bounding volume hierarchy updated at each step.
 class PhysicsSystem final : public System {
 public:
   PhysicsSystem();
 
   constexpr const Vec3f& getGravity() const noexcept { return m_gravity; }
   constexpr float getFriction() const noexcept { return m_friction; }
+  const SweepAndPrune& getBroadphase() const noexcept { return m_broadphase; }
+  bool isSleepingEnabled() const noexcept { return m_isSleepingEnabled; }
+  float getSleepSpeedThreshold() const noexcept { return m_sleepSpeedThreshold; }
+  float getSleepTime() const noexcept { return m_sleepTime; }
+  std::size_t getSolverIterationCount() const noexcept { return m_solverIterationCount; }
+  /// Gets the number of contacts found during the last step.
+  /// \return Number of contacts.
+  std::size_t getContactCount() const noexcept { return m_contactManifolds.size(); }
+  /// Gets the number of batches the contacts of the last step have been split into. The contacts of a same batch share no body.
+  /// \return Number of contact batches.
+  std::size_t getContactBatchCount() const noexcept { return (m_contactBatchOffsets.empty() ? 0 : m_contactBatchOffsets.size() - 1); }
+  /// Gets the number of rigid bodies which have been integrated during the last step.
+  /// \return Number of awake rigid bodies.
+  std::size_t getAwakeBodyCount() const noexcept { return m_awakeBodyCount; }
+  /// Gets the number of rigid bodies which have been skipped during the last step, or put to sleep at its end.
+  /// \return Number of sleeping rigid bodies.
+  std::size_t getSleepingBodyCount() const noexcept { return m_sleepingBodyCount; }
 
   void setGravity(const Vec3f& gravity) { m_gravity = gravity; }
   void setFriction(float friction) {
     assert("Error: Friction coefficient must be between 0 & 1." && (friction >= 0.f && friction <= 1.f));
     m_friction = friction;
   }
+  /// Sets whether resting bodies can be put to sleep. If disabled, the sleeping bodies are woken up on the next step.
+  /// \param enabled True if bodies can sleep, false otherwise.
+  void enableSleeping(bool enabled = true) noexcept { m_isSleepingEnabled = enabled; }
+  /// Sets the speed under which a body is considered resting. Since collisions move bodies back, this speed is not computed from
+  ///   the body's velocity but from its displacement over the sleep time, which must stay under the threshold times the sleep time.
+  /// \param speedThreshold Resting speed threshold, in units per second.
+  void setSleepSpeedThreshold(float speedThreshold) {
+    assert("Error: The sleep speed threshold must not be negative." && speedThreshold >= 0.f);
+    m_sleepSpeedThreshold = speedThreshold;
+  }
+  /// Sets the time during which all the bodies of an island must have been resting before being put to sleep.
+  /// \param sleepTime Time before sleeping, in seconds.
+  void setSleepTime(float sleepTime) {
+    assert("Error: The sleep time must not be negative." && sleepTime >= 0.f);
+    m_sleepTime = sleepTime;
+  }
+  /// Sets the number of iterations made by the contact solver, both to move the bodies out of the colliders & to compute their
+  ///   velocities. More iterations give more accurate results for bodies having several contacts, like in stacks.
+  /// \param iterationCount Number of solver iterations; must be strictly positive.
+  void setSolverIterationCount(std::size_t iterationCount) {
+    assert("Error: The contact solver must run at least one iteration." && iterationCount > 0);
+    m_solverIterationCount = iterationCount;
+  }
 
   bool step(float deltaTime) override;
+  /// Finds the closest collider hit by the given ray.
+  /// \note The colliders are taken as they were at the end of the last step. Colliders whose shape cannot be hit by a ray
+  ///   (lines, quads & OBBs) are ignored.
+  /// \param ray Ray to be cast.
+  /// \param hit Optional closest hit's information to recover (nullptr if unneeded).
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return True if a collider has been hit, false otherwise.
+  bool raycast(const Ray& ray, RaycastHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds all the colliders hit by the given ray.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return Hits' information, sorted by ascending distance.
+  std::vector<RaycastHit> raycastAll(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds the closest collider hit by each of the given rays. If there are enough of them, the rays are split into batches
+  ///   cast in parallel.
+  /// \param rays Rays to be cast.
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return Closest hit of each ray, in the same order as the rays. Rays having hit nothing have no entity.
+  std::vector<RaycastHit> raycastMany(const std::vector<Ray>& rays, float maxDistance = std::numeric_limits<float>::max()) const;
 
 private:
+  /// State of the rigid bodies being integrated, stored as separate arrays of values (SoA) so that they can be processed by packs.
+  struct BodyStates {
+    std::vector<std::size_t> entityIds {};
+    std::vector<RigidBody*> rigidBodies {};
+    std::vector<Transform*> transforms {};
+    std::array<std::vector<float>, 3> positions {}; ///< Positions of the bodies, one array per axis.
+    std::array<std::vector<float>, 3> velocities {}; ///< Velocities of the bodies, one array per axis.
+    std::array<std::vector<float>, 3> forces {}; ///< Forces applied to the bodies, one array per axis.
+    std::vector<float> invMasses {};
+  };
+
+  /// Primitive representing a collider in the ray cast hierarchy.
+  struct RaycastPrimitive {
+    std::size_t primitiveId = Bvh::InvalidId;
+    std::size_t lastUpdate {}; ///< Index of the last update during which the collider has been found.
+  };
+
+  /// Contact between a moving rigid body & a collider, solved by applying impulses along its normal.
+  /// Rigid bodies having no rotation, a single point fully constrains a body along the normal; a manifold thus holds only one.
+  struct ContactManifold {
+    std::size_t bodyEntityId {};
+    std::size_t colliderEntityId {};
+    RigidBody* rigidBody {}; ///< Moving rigid body; nullptr if no contact has been found.
+    Transform* transform {};
+    RigidBody* colliderBody {}; ///< Awake rigid body owning the collider if any, nullptr otherwise; the collider is then immovable.
+    Transform* colliderTransform {};
+    Vec3f* position {}; ///< Position of the body while the contacts are solved, written back into its transform afterwards.
+    Vec3f* colliderPosition {}; ///< Position of the collider while the contacts are solved.
+    Vec3f anchor {}; ///< Point the body must stay in front of, relative to the collider's position.
+    Vec3f normal {}; ///< Contact normal, pointing from the collider towards the body.
+    float invMass {}; ///< Inverse mass of the body when solving the contact.
+    float colliderInvMass {}; ///< Inverse mass of the collider's body when solving the contact; 0 if the collider is immovable.
+    float targetSpeed {}; ///< Relative speed along the normal the body must have once the contact is solved, given its bounciness.
+    float normalImpulse {}; ///< Impulse accumulated along the normal, reused to warm start the contact on the next step.
+    uint32_t color {}; ///< Color of the contact in the graph of the bodies, giving the batch it is solved in.
+    bool isTouching = false; ///< Whether the body still touches the collider once the penetrations have been solved.
+  };
+
+  /// Impulse applied by a contact during the last step, used to warm start the same contact on the next one.
+  struct CachedImpulse {
+    std::size_t bodyEntityId {};
+    std::size_t colliderEntityId {};
+    Vec3f normal {};
+    float normalImpulse {};
+  };
+
+  /// Gathers the awake rigid bodies' state into contiguous arrays, before integrating them.
+  void gatherBodies();
+  /// Integrates the gathered bodies in the given range with a semi-implicit Euler scheme, then writes the results back into
+  ///   their rigid body & transform. Ranges not overlapping can be integrated concurrently.
+  /// \param beginIndex Index of the first body to be integrated.
+  /// \param endIndex Index past the last body to be integrated.
+  /// \param deltaTime Time step.
+  void integrateBodies(std::size_t beginIndex, std::size_t endIndex, float deltaTime);
+  /// Finds the contact between a moving rigid body & a collider, if any.
+  /// \param movingEntity Entity owning the moving rigid body.
+  /// \param colliderEntity Entity owning the collider.
+  /// \param manifold Contact's information to recover.
+  /// \return True if a contact has been found, false otherwise.
+  static bool findContact(Entity& movingEntity, Entity& colliderEntity, ContactManifold& manifold);
+  /// Finds the contact of a rigid body considered as a point with the given collider. Its movement is cast as a ray against the
+  ///   collider; if the ray does not hit it, the body may still have ended up inside the collider's volume.
+  /// \param rigidBody Rigid body to be checked for collision.
+  /// \param transform Transform of the rigid body.
+  /// \param collider Collider to be checked against.
+  /// \param colliderTransform Transform of the collider.
+  /// \param anchor Contact point to recover, relative to the collider's position.
+  /// \param normal Contact normal to recover.
+  /// \return True if a contact has been found, false otherwise.
+  static bool findPointContact(const RigidBody& rigidBody, const Transform& transform, const Collider& collider,
+                               const Transform& colliderTransform, Vec3f& anchor, Vec3f& normal);
+  /// Sweeps the rigid body's shape along its last movement against the given collider, finding its time of impact if any.
+  /// \param rigidBody Rigid body to be swept.
+  /// \param transform Transform of the rigid body.
+  /// \param bodyCollider Collider of the rigid body, whose shape must be a sphere or an AABB.
+  /// \param collider Collider to be checked against.
+  /// \param colliderTransform Transform of the collider.
+  /// \param hit Contact's information to recover.
+  /// \return True if the body's shape hits the collider during its movement, false otherwise.
+  static bool sweepBody(const RigidBody& rigidBody, const Transform& transform, const Collider& bodyCollider,
+                        const Collider& collider, const Transform& colliderTransform, SweepHit& hit);
+  /// Checks if a rigid body's shape is swept to find its collisions, which requires CCD to be enabled & a sphere or box collider.
+  /// \param entity Entity owning the rigid body.
+  /// \param rigidBody Rigid body to be checked.
+  /// \return True if the body's shape is swept, false if it is considered as a point.
+  static bool isShapeSwept(const Entity& entity, const RigidBody& rigidBody);
+  /// Updates the broadphase's proxies from the current colliders & rigid bodies' movements.
+  void updateBroadphase();
+  /// Inserts or updates a collider into the hierarchy used for ray casts.
+  /// \param entity Entity owning the collider.
+  /// \param box World-space bounding box of the collider.
+  void updateRaycastCollider(Entity& entity, const AABB& box);
+  /// Removes the colliders that have not been updated since the last call from the hierarchy used for ray casts, & rebuilds it if
+  ///   many colliders have been inserted.
+  void removeStaleRaycastColliders();
+  /// Checks if a ray hits the collider of the given entity.
+  /// \param ray Ray to be cast, in world space.
+  /// \param entity Entity owning the collider.
+  /// \param hit Hit's information to recover, in world space.
+  /// \return True if the collider has been hit, false otherwise.
+  static bool intersectsCollider(const Ray& ray, const Entity& entity, RayHit& hit);
+  /// Finds the contacts between the moving bodies & the colliders, then solves them all together.
   void solveConstraints();
+  /// Finds the contacts from the broadphase's candidates, wakes up the sleeping bodies that have been hit & fetches the impulses
+  ///   applied by the same contacts during the last step.
+  /// The contacts' positions are copied to be solved, since updating the transforms at each iteration would be costly.
+  void generateContactManifolds();
+  /// Colors the contacts so that no two contacts of the same color share a movable body, then sorts them into a batch per color.
+  void colorContactManifolds();
+  /// Moves the body of a contact, as well as the collider's if it is movable, so that the body does not penetrate the collider.
+  /// \param manifold Contact to be solved.
+  static void solveContactPosition(ContactManifold& manifold);
+  /// Applies the impulse needed for the body of a contact to stop moving towards the collider, or to bounce off it.
+  /// \param manifold Contact to be solved.
+  static void solveContactVelocity(ContactManifold& manifold);
+  /// Applies an impulse along the normal of a contact, to its body & to the collider's if it is movable.
+  /// \param manifold Contact to apply the impulse to.
+  /// \param impulse Impulse to be applied.
+  static void applyContactImpulse(ContactManifold& manifold, float impulse);
+  /// Keeps the impulses applied by the contacts of this step, to warm start them on the next one.
+  void cacheContactImpulses();
+  /// Finds the islands of awake bodies in contact with each other, & puts to sleep those whose bodies have all been resting
+  ///   for long enough.
+  /// \param deltaTime Time step.
+  void updateIslands(float deltaTime);
+  /// Finds the root of the island the given body belongs to, compressing the path to it along the way.
+  /// \param entityId ID of the body's entity.
+  /// \return ID of the entity at the root of the island.
+  std::size_t findIslandRoot(std::size_t entityId);
 
   Vec3f m_gravity  = Vec3f(0.f, -9.80665f, 0.f); ///< Gravity force.
   float m_friction = 0.95f; ///< Friction coefficient.
+
+  bool m_isSleepingEnabled = true;
+  float m_sleepSpeedThreshold = 0.1f; ///< Speed under which a body is considered resting.
+  float m_sleepTime = 0.5f; ///< Time during which an island's bodies must have been resting before being put to sleep.
+  std::size_t m_awakeBodyCount = 0;
+  std::size_t m_sleepingBodyCount = 0;
+  std::size_t m_solverIterationCount = 8;
+
+  BodyStates m_bodyStates {};
+  SweepAndPrune m_broadphase {};
+  std::vector<Entity*> m_proxyEntities {}; ///< Entities owning the broadphase's proxies, indexed by entity ID.
+  std::vector<std::pair<std::size_t, std::size_t>> m_collisionCandidates {}; ///< IDs of the moving & collider entities to be tested.
+  std::vector<ContactManifold> m_contactManifolds {}; ///< Contacts found during the last step, sorted by batch.
+  std::vector<std::size_t> m_contactBatchOffsets {}; ///< Index of the first contact of each batch, followed by the contact count.
+  std::vector<Vec3f> m_solverPositions {}; ///< Positions of the contacts' bodies & colliders while solving them, indexed by entity ID.
+  std::vector<uint64_t> m_bodyColorMasks {}; ///< Colors of the contacts each body is involved in, indexed by entity ID.
+  std::vector<CachedImpulse> m_cachedImpulses {}; ///< Impulses applied by the last step's contacts, sorted by entity IDs.
+  std::vector<std::pair<std::size_t, std::size_t>> m_bodyContacts {}; ///< IDs of the awake bodies' entities having collided together.
+  std::vector<std::size_t> m_islandParents {}; ///< Parent of each awake body in its island's tree, indexed by entity ID.
+  std::vector<float> m_islandRestingTimes {}; ///< Minimum resting time of each island's bodies, indexed by the root's entity ID.
+
+  Bvh m_raycastBvh {}; ///< Hierarchy of the colliders' world-space bounding boxes, used to accelerate ray casts.
+  std::vector<RaycastPrimitive> m_raycastPrimitives {}; ///< Primitive of each collider in the hierarchy, indexed by entity ID.
+  std::vector<Entity*> m_raycastEntities {}; ///< Entities owning the hierarchy's primitives, indexed by primitive ID.
+  std::vector<Entity*> m_unboundedColliderEntities {}; ///< Entities owning colliders with infinite bounds, which are tested separately.
+  std::size_t m_raycastUpdateIndex = 0;
+  std::size_t m_raycastInsertionCount = 0; ///< Number of primitives inserted since the hierarchy has last been rebuilt.
 };
 
 } // namespace Raz
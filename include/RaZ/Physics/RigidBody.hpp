@@ -22,15 +22,45 @@ public:
   constexpr float getBounciness() const noexcept { return m_bounciness; }
   constexpr const Vec3f& getForces() const noexcept { return m_forces; }
   constexpr const Vec3f& getVelocity() const noexcept { return m_velocity; }
+  /// Checks if the rigid body is sleeping, in which case it is neither integrated nor checked for collisions by the physics
+  ///   system until it is woken up.
+  /// \return True if the rigid body is sleeping, false otherwise.
+  constexpr bool isSleeping() const noexcept { return m_isSleeping; }
+  /// Checks if continuous collision detection (CCD) is enabled for the rigid body.
+  /// \return True if CCD is enabled, false otherwise.
+  constexpr bool isCcdEnabled() const noexcept { return m_isCcdEnabled; }
 
   constexpr void setMass(float mass) noexcept { m_mass = mass; }
   constexpr void setBounciness(float bounciness) noexcept {
     assert("Error: The bounciness value must be between 0 & 1." && (bounciness >= 0.f && bounciness <= 1.f));
     m_bounciness = bounciness;
   }
-  constexpr void setVelocity(const Vec3f& velocity) noexcept { m_velocity = velocity; }
+  /// Sets the rigid body's velocity, waking it up if it is sleeping.
+  /// \param velocity New velocity.
+  constexpr void setVelocity(const Vec3f& velocity) noexcept {
+    m_velocity = velocity;
+    wakeUp();
+  }
+
+  /// Enables continuous collision detection (CCD) for the rigid body. If it has a sphere or box collider, this shape is then swept
+  ///   along the body's movement to find its earliest time of impact with the other colliders. Otherwise, or if CCD is disabled,
+  ///   the body is considered as a point.
+  /// \note CCD is more expensive, & should be reserved to fast bodies which could otherwise go through thin colliders.
+  /// \param enabled True if CCD should be enabled, false otherwise.
+  constexpr void enableCcd(bool enabled = true) noexcept { m_isCcdEnabled = enabled; }
 
   constexpr void applyForces(const Vec3f& gravity) noexcept { m_forces = gravity; }
+  /// Applies an impulse to the rigid body, instantly changing its velocity according to its mass & waking it up if it is sleeping.
+  /// \param impulse Impulse to be applied.
+  constexpr void applyImpulse(const Vec3f& impulse) noexcept {
+    m_velocity += impulse * m_invMass;
+    wakeUp();
+  }
+  /// Wakes the rigid body up, so that it is integrated & checked for collisions again.
+  constexpr void wakeUp() noexcept {
+    m_isSleeping  = false;
+    m_restingTime = 0.f;
+  }
 
 private:
   float m_mass {}; ///< Mass of the rigid body.
@@ -40,6 +70,11 @@ private:
   Vec3f m_forces {}; ///< Forces applied to the rigid body.
   Vec3f m_velocity {}; ///< Velocity of the rigid body.
   Vec3f m_oldPosition {}; ///< Previous position of the rigid body.
+
+  Vec3f m_restingPosition {}; ///< Position from which the rigid body's displacement is measured while it is resting.
+  float m_restingTime {}; ///< Time during which the rigid body has been moving slower than the physics system's sleep threshold.
+  bool m_isSleeping = false;
+  bool m_isCcdEnabled = false;
 };
 
 } // namespace Raz
@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef RAZ_SHAPESWEEP_HPP
+#define RAZ_SHAPESWEEP_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+class AABB;
+class Shape;
+class Sphere;
+
+/// Contact found by sweeping a shape along a translation.
+struct SweepHit {
+  float time {}; ///< Fraction of the translation at which the shapes start touching, between 0 & 1.
+  Vec3f normal {}; ///< Contact normal, pointing from the obstacle towards the moving shape.
+};
+
+/// Swept shape tests, finding the time of impact (TOI) of a moving shape against a static one. Unlike checking for an
+///   intersection at the end of a movement, this does not let fast shapes go through thin obstacles.
+namespace ShapeSweep {
+
+/// Finds the first time at which a sphere moving along a translation touches an obstacle.
+/// Planes & spheres are handled analytically. Other obstacles are handled by conservative advancement: the sphere is repeatedly
+///   moved forward by its distance to the obstacle, which can never make it go through; triangles, quads & OBBs are approximated
+///   by their bounding box.
+/// \note Like for rays, planes are one-sided: a sphere whose center is behind a plane does not touch it.
+/// \param sphere Sphere at the beginning of its movement.
+/// \param translation Movement of the sphere.
+/// \param obstacle Static shape to be checked against.
+/// \param hit Optional contact's information to recover (nullptr if unneeded).
+/// \return True if the sphere touches the obstacle while moving towards it, false otherwise. A sphere already overlapping the
+///   obstacle touches it at time 0.
+bool computeTimeOfImpact(const Sphere& sphere, const Vec3f& translation, const Shape& obstacle, SweepHit* hit = nullptr);
+/// Finds the first time at which an axis-aligned box moving along a translation touches an obstacle.
+/// Planes & boxes are handled analytically, & spheres by conservative advancement. Lines, triangles, quads & OBBs are
+///   approximated by their bounding box.
+/// \note Like for rays, planes are one-sided: a box whose center is behind a plane does not touch it.
+/// \param box Box at the beginning of its movement.
+/// \param translation Movement of the box.
+/// \param obstacle Static shape to be checked against.
+/// \param hit Optional contact's information to recover (nullptr if unneeded).
+/// \return True if the box touches the obstacle while moving towards it, false otherwise. A box already overlapping the obstacle
+///   touches it at time 0.
+bool computeTimeOfImpact(const AABB& box, const Vec3f& translation, const Shape& obstacle, SweepHit* hit = nullptr);
+
+} // namespace ShapeSweep
+
+} // namespace Raz
+
+#endif // RAZ_SHAPESWEEP_HPP
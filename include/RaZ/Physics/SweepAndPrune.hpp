@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef RAZ_SWEEPANDPRUNE_HPP
+#define RAZ_SWEEPANDPRUNE_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Raz {
+
+class AABB;
+
+/// Broadphase collision detection, finding the pairs of axis-aligned boxes that overlap each other.
+/// Boxes (or proxies) are kept sorted along the axis on which they are the most spread out, and the list is swept to only
+///   test the boxes overlapping on that axis. Since proxies usually move little between two computations, the order from
+///   the previous one is reused and fixed with an insertion sort, making the sort nearly linear in practice.
+/// Proxies are identified by user-defined IDs, which should be kept as compact as possible since they are used as indices.
+class SweepAndPrune {
+public:
+  using ProxyPair = std::pair<std::size_t, std::size_t>;
+
+  static constexpr uint32_t AllCategories = std::numeric_limits<uint32_t>::max();
+
+  SweepAndPrune() = default;
+
+  std::size_t getProxyCount() const noexcept { return m_sortedProxies.size(); }
+  std::size_t getSweepAxis() const noexcept { return m_sweepAxis; }
+  const std::vector<ProxyPair>& getOverlappingPairs() const noexcept { return m_overlappingPairs; }
+
+  /// Checks if a proxy exists with the given ID.
+  /// \param proxyId ID of the proxy to be checked.
+  /// \return True if the proxy exists, false otherwise.
+  bool hasProxy(std::size_t proxyId) const noexcept { return (proxyId < m_proxies.size() && m_proxies[proxyId].isValid); }
+  /// Adds a proxy or updates an existing one.
+  /// Two proxies can only form a pair if each one's category is included in the other's mask.
+  /// \param proxyId ID of the proxy to be set.
+  /// \param box Bounding box of the proxy.
+  /// \param category Bits representing the categories the proxy belongs to.
+  /// \param mask Bits representing the categories the proxy can be paired with.
+  void setProxy(std::size_t proxyId, const AABB& box, uint32_t category = AllCategories, uint32_t mask = AllCategories);
+  /// Removes a proxy. Does nothing if no proxy exists with the given ID.
+  /// \param proxyId ID of the proxy to be removed.
+  void removeProxy(std::size_t proxyId);
+  /// Computes all the pairs of proxies whose boxes overlap each other.
+  /// \note Proxies that have not been set since the last computation are considered stale and are removed beforehand.
+  /// \return Overlapping pairs, each holding the lowest ID first, and sorted in ascending order.
+  const std::vector<ProxyPair>& computeOverlappingPairs();
+  /// Removes all proxies & pairs.
+  void clear() noexcept;
+
+private:
+  struct Proxy {
+    Vec3f minPos {};
+    Vec3f maxPos {};
+    uint32_t category {};
+    uint32_t mask {};
+    std::size_t lastUpdate {};
+    bool isValid = false;
+  };
+
+  void sortProxies();
+
+  std::vector<Proxy> m_proxies {}; ///< Proxies, indexed by their IDs.
+  std::vector<std::size_t> m_sortedProxies {}; ///< IDs of the valid proxies, sorted by their min position along the sweep axis.
+  std::vector<std::size_t> m_activeProxies {}; ///< IDs of the proxies overlapping the current position on the sweep axis.
+  std::vector<ProxyPair> m_overlappingPairs {};
+  std::size_t m_sweepAxis = 0;
+  std::size_t m_computationIndex = 0;
+  bool m_isFullSortNeeded = false;
+};
+
+} // namespace Raz
+
+#endif // RAZ_SWEEPANDPRUNE_HPP
@@ -7,8 +7,11 @@
 
 #include "Application.hpp"
 #include "Component.hpp"
+#include "ComponentStorage.hpp"
 #include "Entity.hpp"
+#include "EntityQuery.hpp"
 #include "System.hpp"
+#include "SystemGraph.hpp"
 #include "World.hpp"
 #include "Animation/Skeleton.hpp"
 #include "Audio/AudioSystem.hpp"
@@ -19,10 +22,13 @@
 #include "Math/Matrix.hpp"
 #include "Math/Quaternion.hpp"
 #include "Math/Transform.hpp"
+#include "Math/TransformSystem.hpp"
 #include "Math/Vector.hpp"
 #include "Physics/Collider.hpp"
 #include "Physics/PhysicsSystem.hpp"
 #include "Physics/RigidBody.hpp"
+#include "Physics/ShapeSweep.hpp"
+#include "Physics/SweepAndPrune.hpp"
 #include "Render/Camera.hpp"
 #include "Render/Cubemap.hpp"
 #include "Render/Framebuffer.hpp"
@@ -39,6 +45,7 @@
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
 #include "Utils/Bitset.hpp"
+#include "Utils/Bvh.hpp"
 #include "Utils/BvhFormat.hpp"
 #include "Utils/CompilerUtils.hpp"
 #include "Utils/EnumUtils.hpp"
@@ -48,8 +55,12 @@
 #include "Utils/Image.hpp"
 #include "Utils/Input.hpp"
 #include "Utils/Overlay.hpp"
+#include "Utils/PoolAllocator.hpp"
+#include "Utils/Profiler.hpp"
 #include "Utils/Ray.hpp"
+#include "Utils/RayPacket.hpp"
 #include "Utils/Shape.hpp"
+#include "Utils/SimdUtils.hpp"
 #include "Utils/StrUtils.hpp"
 #include "Utils/Threading.hpp"
 #include "Utils/TypeUtils.hpp"
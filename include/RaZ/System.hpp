@@ -6,14 +6,20 @@
 #include "RaZ/Entity.hpp"
 #include "RaZ/Utils/Bitset.hpp"
 
+#include <limits>
 #include <vector>
 
 namespace Raz {
 
+class World;
+
 class System;
 using SystemPtr = std::unique_ptr<System>;
 
 /// System class representing a base System to be inherited.
+/// A system declaring the components it reads & writes may be updated concurrently with the other systems which don't
+///   access the same components. Such a system must then neither access any other component, nor change the entities' structure
+///   during its update. A system declaring nothing is considered to access everything, & is updated on the world's thread.
 class System {
   friend class World;
 
@@ -22,6 +28,11 @@ public:
   System(System&&) noexcept = delete;
 
   const Bitset& getAcceptedComponents() const { return m_acceptedComponents; }
+  const Bitset& getReadComponents() const noexcept { return m_readComponents; }
+  const Bitset& getWriteComponents() const noexcept { return m_writeComponents; }
+  /// Checks if the system has declared the components it reads or writes during its update.
+  /// \return True if the system has declared its accesses, false otherwise.
+  bool hasDeclaredAccesses() const noexcept { return (!m_readComponents.isEmpty() || !m_writeComponents.isEmpty()); }
 
   /// Gets the ID of the given system.
   /// It uses CRTP to assign a different ID to each system it is called with.
@@ -30,10 +41,10 @@ public:
   /// \tparam T Type of the system to get the ID for.
   /// \return Given system's ID.
   template <typename T> static std::size_t getId();
-  /// Checks if the system contains the given entity.
+  /// Checks if the system contains the given entity. This check is made in constant time.
   /// \param entity Entity to be checked.
   /// \return True if the system contains the entity, false otherwise.
-  bool containsEntity(const EntityPtr& entity);
+  bool containsEntity(const EntityPtr& entity) const noexcept;
   /// Updates the system with a variable time step. For a constant step update, use step().
   /// \param deltaTime Time elapsed since the last update.
   /// \return True if the system is still active, false otherwise.
@@ -57,13 +68,20 @@ protected:
   /// \param entity Entity to be linked.
   virtual void linkEntity(const EntityPtr& entity);
   /// Unlinks the entity from the system.
+  /// \note The last linked entity takes the place of the unlinked one; the linked entities' order is thus not preserved.
   /// \param entity Entity to be unlinked.
   virtual void unlinkEntity(const EntityPtr& entity);
 
   std::vector<Entity*> m_entities {};
+  std::vector<std::size_t> m_entityPositions {}; ///< Position of each linked entity in the list, indexed by the entity's ID.
   Bitset m_acceptedComponents {};
+  Bitset m_readComponents {}; ///< Components only read by the system during its update.
+  Bitset m_writeComponents {}; ///< Components modified by the system during its update.
+  World* m_world {}; ///< World owning the system, if any.
 
 private:
+  static constexpr std::size_t InvalidPosition = std::numeric_limits<std::size_t>::max();
+
   static inline std::size_t m_maxId = 0;
 };
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef RAZ_SYSTEMGRAPH_HPP
+#define RAZ_SYSTEMGRAPH_HPP
+
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/Graph.hpp"
+
+#include <atomic>
+#include <functional>
+
+namespace Raz {
+
+class SystemGraph;
+
+/// Node of a SystemGraph, representing a system to be executed once all its parents have been.
+class SystemNode final : public GraphNode<SystemNode> {
+  friend SystemGraph;
+
+public:
+  SystemNode(System& system, std::size_t systemIndex) : m_system{ &system }, m_systemIndex{ systemIndex } {}
+
+  const System& getSystem() const noexcept { return *m_system; }
+  System& getSystem() noexcept { return *m_system; }
+  std::size_t getSystemIndex() const noexcept { return m_systemIndex; }
+  /// Gets the number of systems which must be executed before this one.
+  /// \return Parent node count.
+  std::size_t getParentCount() const noexcept { return m_parentCount; }
+  /// Checks if the system must be executed on the thread executing the graph; this is the case if it has not declared its accesses.
+  /// \return True if the system is bound to the executing thread, false if it can be run on any thread.
+  bool isExclusive() const noexcept { return !m_system->hasDeclaredAccesses(); }
+  /// Gets the time the system has taken to be executed the last time the graph has been.
+  /// \return Last execution time, in seconds.
+  float getExecutionTime() const noexcept { return m_executionTime; }
+  /// Checks if the system was still active after the last execution of the graph.
+  /// \return True if the system is active, false otherwise.
+  bool isSystemActive() const noexcept { return m_isSystemActive; }
+
+private:
+  System* m_system {};
+  std::size_t m_systemIndex {};
+  std::size_t m_parentCount = 0;
+  std::atomic<std::size_t> m_remainingParentCount = 0; ///< Number of parents left to be executed during the current execution.
+  float m_executionTime = 0.f;
+  bool m_isSystemActive = true;
+  float m_pathTime = 0.f; ///< Time of the longest path ending with this node.
+  const SystemNode* m_pathPredecessor {}; ///< Previous node on the longest path ending with this one.
+};
+
+/// Graph of dependencies between systems, allowing those which don't conflict with each other to be executed concurrently.
+/// Two systems conflict if one of them writes a component the other reads or writes, or if any of them has not declared
+///   its accesses; the one with the lowest ID is then executed first, as when all systems are executed sequentially.
+class SystemGraph : public Graph<SystemNode> {
+public:
+  SystemGraph() = default;
+  SystemGraph(const SystemGraph&) = delete;
+  SystemGraph(SystemGraph&&) noexcept = default;
+
+  /// Gets the longest chain of dependent systems, according to their durations during the last execution.
+  /// This is the minimal time the graph's execution can take, however many threads are available.
+  /// \return Nodes of the critical path, in execution order.
+  const std::vector<const SystemNode*>& getCriticalPath() const noexcept { return m_criticalPath; }
+  /// Gets the total execution time of the critical path's systems during the last execution.
+  /// \return Critical path's time, in seconds.
+  float getCriticalPathTime() const noexcept { return m_criticalPathTime; }
+
+  /// Checks if two systems can't be executed concurrently.
+  /// \param system1 First system to be checked.
+  /// \param system2 Second system to be checked.
+  /// \return True if the systems conflict with each other, false otherwise.
+  static bool areConflicting(const System& system1, const System& system2) noexcept;
+  /// Rebuilds the graph with the given systems.
+  /// \param systems Systems to create the nodes from, in execution order. Null systems are ignored.
+  /// \param activeSystems Systems to be kept; the others are ignored.
+  void build(const std::vector<SystemPtr>& systems, const Bitset& activeSystems);
+  /// Executes all the systems, each one starting as soon as all its parents have finished.
+  /// Systems which have declared their accesses are run on the default thread pool; the others are run on the calling thread.
+  /// If any system throws an exception, the remaining ones are still executed before the first exception is rethrown.
+  /// \param action Function executing the system of the given index, returning true if it is still active & false otherwise.
+  void execute(const std::function<bool(std::size_t)>& action);
+
+  SystemGraph& operator=(const SystemGraph&) = delete;
+  SystemGraph& operator=(SystemGraph&&) noexcept = default;
+
+private:
+  /// Computes the critical path from the systems' last execution times.
+  void computeCriticalPath();
+
+  std::vector<const SystemNode*> m_criticalPath {};
+  float m_criticalPathTime = 0.f;
+};
+
+} // namespace Raz
+
+#endif // RAZ_SYSTEMGRAPH_HPP
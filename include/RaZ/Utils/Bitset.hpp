@@ -4,28 +4,57 @@
 #define RAZ_BITSET_HPP
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <initializer_list>
 #include <vector>
 
 namespace Raz {
 
+/// Dynamically-sized set of bits, packed into 64-bit words.
+/// Up to InlineBitCount bits are stored inside the bitset itself; only larger bitsets allocate memory. Since component &
+///   system signatures are far below this size, manipulating them never allocates.
 class Bitset {
 public:
+  using Word = uint64_t;
+
+  static constexpr std::size_t WordBitCount    = sizeof(Word) * 8;
+  static constexpr std::size_t InlineWordCount = 2;
+  static constexpr std::size_t InlineBitCount  = InlineWordCount * WordBitCount; ///< Number of bits that can be stored without allocating.
+
   Bitset() = default;
-  explicit Bitset(std::size_t bitCount, bool initVal = false) : m_bits(bitCount, initVal) {}
-  Bitset(std::initializer_list<bool> values) : m_bits(values.begin(), values.end()) {}
+  explicit Bitset(std::size_t bitCount, bool initVal = false);
+  Bitset(std::initializer_list<bool> values);
+  Bitset(const Bitset&) = default;
+  Bitset(Bitset&& bitset) noexcept;
 
-  const std::vector<bool>& getBits() const noexcept { return m_bits; }
-  std::vector<bool>& getBits() noexcept { return m_bits; }
-  std::size_t getSize() const noexcept { return m_bits.size(); }
+  std::size_t getSize() const noexcept { return m_bitCount; }
+  /// Gets the number of words needed to store all the bits.
+  /// \return Word count.
+  std::size_t getWordCount() const noexcept { return computeWordCount(m_bitCount); }
+  /// Gets the words in which the bits are packed. Bits past the bitset's size are always disabled.
+  /// \return Pointer to the first word.
+  const Word* getWords() const noexcept { return (m_bitCount <= InlineBitCount ? m_inlineWords.data() : m_heapWords.data()); }
 
-  bool isEmpty() const noexcept { return (std::find(m_bits.cbegin(), m_bits.cend(), true) == m_bits.cend()); }
-  std::size_t getEnabledBitCount() const noexcept { return static_cast<std::size_t>(std::count(m_bits.cbegin(), m_bits.cend(), true)); }
-  std::size_t getDisabledBitCount() const noexcept { return m_bits.size() - getEnabledBitCount(); }
+  bool isEmpty() const noexcept;
+  std::size_t getEnabledBitCount() const noexcept;
+  std::size_t getDisabledBitCount() const noexcept { return m_bitCount - getEnabledBitCount(); }
+  /// Checks if at least one bit is enabled in both bitsets.
+  /// \param bitset Bitset to be checked.
+  /// \return True if both bitsets have a common enabled bit, false otherwise.
+  bool intersects(const Bitset& bitset) const noexcept;
+  /// Checks if all the bits enabled in the given bitset are enabled in this one as well.
+  /// \param bitset Bitset to be checked.
+  /// \return True if this bitset includes the given one, false otherwise.
+  bool includes(const Bitset& bitset) const noexcept;
+  /// Calls the given function for each enabled bit, in increasing order.
+  /// \tparam Func Type of the function to be called.
+  /// \param func Function to be called, taking the enabled bit's position.
+  template <typename Func> void forEachEnabledBit(Func&& func) const;
   void setBit(std::size_t position, bool value = true);
-  void resize(std::size_t newSize) { m_bits.resize(newSize); }
-  void clear() noexcept { m_bits.clear(); }
+  void resize(std::size_t newSize);
+  void clear() noexcept;
 
   Bitset operator~() const noexcept;
   Bitset operator&(const Bitset& bitset) const noexcept;
@@ -38,16 +67,32 @@ public:
   Bitset& operator^=(const Bitset& bitset) noexcept;
   Bitset& operator<<=(std::size_t shift);
   Bitset& operator>>=(std::size_t shift);
-  bool operator[](std::size_t index) const noexcept { return m_bits[index]; }
-  bool operator==(const Bitset& bitset) const noexcept { return std::equal(m_bits.cbegin(), m_bits.cend(), bitset.getBits().cbegin()); }
+  Bitset& operator=(const Bitset&) = default;
+  Bitset& operator=(Bitset&& bitset) noexcept;
+  bool operator[](std::size_t index) const noexcept { return ((getWords()[index / WordBitCount] >> (index % WordBitCount)) & 1u); }
+  /// Checks if the first bits of the given bitset are equal to this bitset's.
+  /// \param bitset Bitset to be compared with. It must have at least as many bits as this one to be considered equal.
+  /// \return True if the bitsets are equal, false otherwise.
+  bool operator==(const Bitset& bitset) const noexcept;
   bool operator!=(const Bitset& bitset) const noexcept { return !(*this == bitset); }
   friend std::ostream& operator<<(std::ostream& stream, const Bitset& bitset);
 
 private:
-  std::vector<bool> m_bits {};
+  static constexpr std::size_t computeWordCount(std::size_t bitCount) noexcept { return (bitCount + WordBitCount - 1) / WordBitCount; }
+  static std::size_t countEnabledBits(Word word) noexcept;
+  static std::size_t findFirstEnabledBit(Word word) noexcept;
+
+  Word* getWords() noexcept { return const_cast<Word*>(static_cast<const Bitset*>(this)->getWords()); }
+  /// Disables the bits past the bitset's size, which must always remain so.
+  void clearUnusedBits() noexcept;
+
+  std::size_t m_bitCount = 0;
+  std::array<Word, InlineWordCount> m_inlineWords {};
+  std::vector<Word> m_heapWords {}; ///< Words used instead of the inline ones if there are more than InlineBitCount bits.
 };
 
 } // namespace Raz
 
-#endif // RAZ_BITSET_HPP
+#include "RaZ/Utils/Bitset.inl"
 
+#endif // RAZ_BITSET_HPP
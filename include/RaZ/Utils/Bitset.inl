@@ -0,0 +1,97 @@
+#if defined(RAZ_COMPILER_MSVC) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace Raz {
+
+inline std::size_t Bitset::countEnabledBits(Word word) noexcept {
+#if defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#elif defined(RAZ_COMPILER_MSVC) && defined(_M_X64)
+  return static_cast<std::size_t>(__popcnt64(word));
+#else
+  std::size_t count = 0;
+
+  for (; word != 0; word &= word - 1)
+    ++count;
+
+  return count;
+#endif
+}
+
+inline std::size_t Bitset::findFirstEnabledBit(Word word) noexcept {
+#if defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#elif defined(RAZ_COMPILER_MSVC) && defined(_M_X64)
+  unsigned long index {};
+  _BitScanForward64(&index, word);
+  return index;
+#else
+  std::size_t index = 0;
+
+  for (; (word & 1u) == 0; word >>= 1u)
+    ++index;
+
+  return index;
+#endif
+}
+
+inline bool Bitset::isEmpty() const noexcept {
+  const Word* words = getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex) {
+    if (words[wordIndex] != 0)
+      return false;
+  }
+
+  return true;
+}
+
+inline std::size_t Bitset::getEnabledBitCount() const noexcept {
+  const Word* words = getWords();
+  std::size_t count = 0;
+
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex)
+    count += countEnabledBits(words[wordIndex]);
+
+  return count;
+}
+
+inline bool Bitset::intersects(const Bitset& bitset) const noexcept {
+  const Word* words      = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < std::min(getWordCount(), bitset.getWordCount()); ++wordIndex) {
+    if ((words[wordIndex] & otherWords[wordIndex]) != 0)
+      return true;
+  }
+
+  return false;
+}
+
+inline bool Bitset::includes(const Bitset& bitset) const noexcept {
+  const Word* words      = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < bitset.getWordCount(); ++wordIndex) {
+    const Word word = (wordIndex < getWordCount() ? words[wordIndex] : 0);
+
+    if ((word & otherWords[wordIndex]) != otherWords[wordIndex])
+      return false;
+  }
+
+  return true;
+}
+
+template <typename Func>
+void Bitset::forEachEnabledBit(Func&& func) const {
+  const Word* words = getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex) {
+    // Repeatedly finding the lowest enabled bit & disabling it, until none remains
+    for (Word word = words[wordIndex]; word != 0; word &= word - 1)
+      func(wordIndex * WordBitCount + findFirstEnabledBit(word));
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,166 @@
+#pragma once
+
+#ifndef RAZ_BVH_HPP
+#define RAZ_BVH_HPP
+
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <limits>
+#include <variant>
+#include <vector>
+
+namespace Raz {
+
+/// Bounding volume hierarchy hit, giving the primitive that has been hit alongside the ray hit's information.
+struct BvhHit {
+  std::size_t primitiveId = std::numeric_limits<std::size_t>::max();
+  RayHit rayHit {};
+};
+
+/// Dynamic bounding volume hierarchy, accelerating ray & overlap queries against a set of primitives.
+/// A primitive can either be a mere AABB, a triangle (for example from a mesh), or any shape. Shapes are referenced
+///   and not copied; they must thus outlive the hierarchy, or be removed from it beforehand.
+/// The hierarchy is a binary tree holding a single primitive per leaf. It can be fully rebuilt with build(), which uses
+///   the surface area heuristic (SAH) to find the best splits, or be modified incrementally through insertions & removals.
+///   When primitives move, refit() updates the bounding boxes without changing the tree's structure; since the tree's
+///   quality degrades as primitives move away from their initial position, it should be rebuilt from time to time.
+class Bvh {
+public:
+  static constexpr std::size_t InvalidId = std::numeric_limits<std::size_t>::max();
+
+  Bvh() = default;
+  Bvh(const Bvh&) = default;
+  Bvh(Bvh&&) noexcept = default;
+
+  std::size_t getPrimitiveCount() const noexcept { return m_primitiveCount; }
+  bool isEmpty() const noexcept { return (m_primitiveCount == 0); }
+  /// Gets the box containing all the primitives of the hierarchy. The hierarchy must not be empty.
+  /// \return Root bounding box.
+  const AABB& getBoundingBox() const noexcept;
+  /// Gets the bounding box of a primitive as currently known by the hierarchy.
+  /// \param primitiveId ID of the primitive to get the box of.
+  /// \return Primitive's bounding box.
+  const AABB& getPrimitiveBox(std::size_t primitiveId) const noexcept;
+
+  /// Checks if a primitive exists with the given ID.
+  /// \param primitiveId ID of the primitive to be checked.
+  /// \return True if the primitive exists, false otherwise.
+  bool contains(std::size_t primitiveId) const noexcept {
+    return (primitiveId < m_primitives.size() && m_primitives[primitiveId].leafIndex != InvalidIndex);
+  }
+  /// Adds a box primitive into the hierarchy. Rays hitting this primitive will return the hit on the box itself.
+  /// \param box Box to be added.
+  /// \return ID of the added primitive.
+  std::size_t insert(const AABB& box);
+  /// Adds a triangle primitive into the hierarchy. The triangle is copied.
+  /// \param triangle Triangle to be added.
+  /// \return ID of the added primitive.
+  std::size_t insert(const Triangle& triangle);
+  /// Adds a shape primitive into the hierarchy. The shape is referenced, and must outlive the hierarchy.
+  /// \param shape Shape to be added.
+  /// \return ID of the added primitive.
+  std::size_t insert(const Shape& shape);
+  /// Removes a primitive from the hierarchy. Its ID may be reused by a later insertion.
+  /// \param primitiveId ID of the primitive to be removed.
+  void remove(std::size_t primitiveId);
+  /// Changes the box of a box primitive, updating the bounding boxes containing it.
+  /// \param primitiveId ID of the box primitive to be updated.
+  /// \param box New box of the primitive.
+  void update(std::size_t primitiveId, const AABB& box);
+  /// Recomputes the bounding box of a triangle or shape primitive, updating the bounding boxes containing it.
+  /// \param primitiveId ID of the primitive to be updated.
+  void update(std::size_t primitiveId);
+  /// Recomputes the bounding boxes of all triangle & shape primitives and of all the tree's nodes, keeping its structure.
+  void refit();
+  /// Rebuilds the whole tree from the current primitives using the surface area heuristic.
+  void build();
+  /// Removes all primitives.
+  void clear() noexcept;
+
+  /// Finds the closest primitive hit by the given ray.
+  /// \param ray Ray to be cast.
+  /// \param hit Optional closest hit's information to recover (nullptr if unneeded).
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return True if a primitive has been hit, false otherwise.
+  bool castClosest(const Ray& ray, BvhHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds any primitive hit by the given ray, stopping at the first one found. Well suited for visibility checks.
+  /// \param ray Ray to be cast.
+  /// \param hit Optional hit's information to recover (nullptr if unneeded).
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return True if a primitive has been hit, false otherwise.
+  bool castAny(const Ray& ray, BvhHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds all the primitives hit by the given ray.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  /// \return Hits' information, sorted by ascending distance.
+  std::vector<BvhHit> castAll(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Calls the given function for each primitive whose bounding box is hit by the ray, closest boxes first. This allows testing
+  ///   the primitives against the ray with custom checks, for example when they stand for external objects.
+  /// \tparam Func Type of the function to be called.
+  /// \param ray Ray to be cast.
+  /// \param func Function to be called with the ID of the primitive & the maximum distance, as a reference it may lower once a
+  ///   closer hit has been found. It returns true to continue the traversal, false to stop it.
+  /// \param maxDistance Maximum distance at which a hit is considered.
+  template <typename Func> void traverse(const Ray& ray, Func&& func, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Finds all the primitives whose bounding box overlaps the given box.
+  /// \param box Box to be checked.
+  /// \return IDs of the overlapping primitives, in no particular order.
+  std::vector<std::size_t> queryOverlaps(const AABB& box) const;
+
+  Bvh& operator=(const Bvh&) = default;
+  Bvh& operator=(Bvh&&) noexcept = default;
+
+private:
+  static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+  struct Primitive {
+    std::variant<std::monostate, Triangle, const Shape*> shape {}; ///< Shape to be tested against rays; a mere box if none.
+    std::size_t leafIndex = InvalidIndex;
+  };
+
+  struct Node {
+    AABB box = AABB(Vec3f(0.f), Vec3f(0.f));
+    std::size_t parentIndex = InvalidIndex;
+    std::size_t firstChildIndex = InvalidIndex;
+    std::size_t secondChildIndex = InvalidIndex;
+    std::size_t primitiveId = InvalidId; ///< Primitive held by the node if it is a leaf, InvalidId otherwise.
+
+    bool isLeaf() const noexcept { return (primitiveId != InvalidId); }
+  };
+
+  std::size_t insertPrimitive(Primitive&& primitive, const AABB& box);
+  std::size_t allocateNode();
+  void freeNode(std::size_t nodeIndex);
+  void insertLeaf(std::size_t leafIndex);
+  void removeLeaf(std::size_t leafIndex);
+  /// Recomputes the bounding boxes of all the ancestors of the given node.
+  /// \param nodeIndex Index of the node to start from, excluded.
+  void refitAncestors(std::size_t nodeIndex);
+  /// Recursively builds a subtree from the given leaves.
+  /// \param leafIndices Indices of the leaves to build the subtree from; may be reordered.
+  /// \param centroids Centroid of each leaf's bounding box, indexed by node index.
+  /// \param begin Index of the first leaf of the subtree in leafIndices.
+  /// \param end Index past the last leaf of the subtree in leafIndices.
+  /// \return Index of the subtree's root node.
+  std::size_t buildSubtree(std::vector<std::size_t>& leafIndices, const std::vector<Vec3f>& centroids, std::size_t begin, std::size_t end);
+  /// Tests a ray against a single primitive.
+  /// \param ray Ray to be tested.
+  /// \param primitiveId ID of the primitive to be tested.
+  /// \param hit Hit's information to recover.
+  /// \return True if the primitive has been hit, false otherwise.
+  bool intersectsPrimitive(const Ray& ray, std::size_t primitiveId, RayHit& hit) const;
+
+  std::vector<Primitive> m_primitives {}; ///< Primitives, indexed by their IDs.
+  std::vector<std::size_t> m_freePrimitiveIds {};
+  std::size_t m_primitiveCount = 0;
+  std::vector<Node> m_nodes {};
+  std::vector<std::size_t> m_freeNodeIndices {};
+  std::size_t m_rootIndex = InvalidIndex;
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/Bvh.inl"
+
+#endif // RAZ_BVH_HPP
@@ -0,0 +1,56 @@
+namespace Raz {
+
+template <typename Func>
+void Bvh::traverse(const Ray& ray, Func&& func, float maxDistance) const {
+  if (m_rootIndex == InvalidIndex)
+    return;
+
+  float rootDistance {};
+
+  if (!ray.intersects(m_nodes[m_rootIndex].box, rootDistance) || rootDistance > maxDistance)
+    return;
+
+  // Each node is stored along with the distance at which the ray enters its box, so that nodes can be skipped if a closer
+  //  hit has been found in the meantime
+  std::vector<std::pair<std::size_t, float>> nodeStack;
+  nodeStack.emplace_back(m_rootIndex, rootDistance);
+
+  while (!nodeStack.empty()) {
+    const auto [nodeIndex, nodeDistance] = nodeStack.back();
+    nodeStack.pop_back();
+
+    if (nodeDistance > maxDistance)
+      continue;
+
+    const Node& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      if (!func(node.primitiveId, maxDistance))
+        return;
+
+      continue;
+    }
+
+    float firstDistance {};
+    float secondDistance {};
+    const bool hitsFirstChild  = ray.intersects(m_nodes[node.firstChildIndex].box, firstDistance) && firstDistance <= maxDistance;
+    const bool hitsSecondChild = ray.intersects(m_nodes[node.secondChildIndex].box, secondDistance) && secondDistance <= maxDistance;
+
+    // The closest child is pushed last, so that it is processed first
+    if (hitsFirstChild && hitsSecondChild) {
+      if (firstDistance < secondDistance) {
+        nodeStack.emplace_back(node.secondChildIndex, secondDistance);
+        nodeStack.emplace_back(node.firstChildIndex, firstDistance);
+      } else {
+        nodeStack.emplace_back(node.firstChildIndex, firstDistance);
+        nodeStack.emplace_back(node.secondChildIndex, secondDistance);
+      }
+    } else if (hitsFirstChild) {
+      nodeStack.emplace_back(node.firstChildIndex, firstDistance);
+    } else if (hitsSecondChild) {
+      nodeStack.emplace_back(node.secondChildIndex, secondDistance);
+    }
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,65 @@
+#pragma once
+
+#ifndef RAZ_POOLALLOCATOR_HPP
+#define RAZ_POOLALLOCATOR_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Raz {
+
+/// Allocator of objects of a single type, reserving memory in fixed-size slabs.
+/// Objects allocated one after the other are placed contiguously, & freed slots are reused by the next allocations; memory is
+///   only given back to the system when the allocator is destroyed.
+/// \note Allocating & deallocating are thread-safe.
+/// \tparam T Type of the objects to be allocated.
+/// \tparam SlabSize Number of objects each slab can hold.
+template <typename T, std::size_t SlabSize = 256>
+class PoolAllocator {
+  static_assert(SlabSize > 0, "Error: A pool allocator's slabs must be able to hold at least one object.");
+
+public:
+  PoolAllocator() = default;
+  PoolAllocator(const PoolAllocator&) = delete;
+  PoolAllocator(PoolAllocator&&) noexcept = delete;
+
+  /// Gets the number of slabs that have been reserved.
+  /// \return Slab count.
+  std::size_t getSlabCount() const;
+  /// Gets the number of objects which can be allocated without reserving a new slab.
+  /// \return Total number of slots, occupied or not.
+  std::size_t getCapacity() const { return getSlabCount() * SlabSize; }
+  /// Gets the number of objects currently allocated.
+  /// \return Number of occupied slots.
+  std::size_t getAllocatedCount() const;
+
+  /// Allocates memory for one object, reserving a new slab if all slots are occupied.
+  /// \note The object is not constructed; this must be done with a placement new.
+  /// \return Pointer to the allocated memory.
+  T* allocate();
+  /// Gives back the memory of an object to the allocator, making its slot available for the next allocations.
+  /// \note The object is not destroyed; this must be done beforehand.
+  /// \param object Object to be deallocated. It must have been allocated by this allocator.
+  void deallocate(T* object) noexcept;
+
+  PoolAllocator& operator=(const PoolAllocator&) = delete;
+  PoolAllocator& operator=(PoolAllocator&&) noexcept = delete;
+
+private:
+  union Slot {
+    Slot* nextFreeSlot;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  std::vector<std::unique_ptr<Slot[]>> m_slabs {};
+  Slot* m_firstFreeSlot {}; ///< Head of the list of available slots, linked through the slots themselves.
+  std::size_t m_allocatedCount = 0;
+  mutable std::mutex m_mutex {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/PoolAllocator.inl"
+
+#endif // RAZ_POOLALLOCATOR_HPP
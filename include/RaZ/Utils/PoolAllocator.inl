@@ -0,0 +1,53 @@
+#include <cassert>
+
+namespace Raz {
+
+template <typename T, std::size_t SlabSize>
+std::size_t PoolAllocator<T, SlabSize>::getSlabCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_slabs.size();
+}
+
+template <typename T, std::size_t SlabSize>
+std::size_t PoolAllocator<T, SlabSize>::getAllocatedCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_allocatedCount;
+}
+
+template <typename T, std::size_t SlabSize>
+T* PoolAllocator<T, SlabSize>::allocate() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_firstFreeSlot == nullptr) {
+    Slot* slab = m_slabs.emplace_back(std::make_unique<Slot[]>(SlabSize)).get();
+
+    // Linking the new slots in order, so that the next allocations are contiguous in memory
+    for (std::size_t slotIndex = 0; slotIndex < SlabSize - 1; ++slotIndex)
+      slab[slotIndex].nextFreeSlot = &slab[slotIndex + 1];
+    slab[SlabSize - 1].nextFreeSlot = nullptr;
+
+    m_firstFreeSlot = slab;
+  }
+
+  Slot* slot      = m_firstFreeSlot;
+  m_firstFreeSlot = slot->nextFreeSlot;
+  ++m_allocatedCount;
+
+  return reinterpret_cast<T*>(slot->storage);
+}
+
+template <typename T, std::size_t SlabSize>
+void PoolAllocator<T, SlabSize>::deallocate(T* object) noexcept {
+  if (object == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  assert("Error: Cannot deallocate more objects than have been allocated." && m_allocatedCount > 0);
+
+  Slot* slot         = reinterpret_cast<Slot*>(object);
+  slot->nextFreeSlot = m_firstFreeSlot;
+  m_firstFreeSlot    = slot;
+  --m_allocatedCount;
+}
+
+} // namespace Raz
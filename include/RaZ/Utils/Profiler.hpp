@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef RAZ_PROFILER_HPP
+#define RAZ_PROFILER_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Raz {
+
+class FilePath;
+
+namespace Profiler {
+
+struct ThreadBuffer;
+
+/// Single execution of a zone, recorded when leaving it.
+struct ZoneEvent {
+  const char* name {};
+  uint64_t startTime {}; ///< Time at which the zone has been entered, in nanoseconds since the profiler's creation.
+  uint64_t duration {}; ///< Time spent in the zone, in nanoseconds.
+  uint32_t depth {}; ///< Number of zones the zone is nested in, on the thread which executed it.
+  uint32_t threadIndex {}; ///< Index of the thread which executed the zone, given in the order the threads recorded their first zone.
+};
+
+/// Statistics of a zone over the last frames; the time spent in a zone during a frame is the sum of all its executions.
+struct ZoneStats {
+  std::string_view name {};
+  std::size_t frameCount {}; ///< Number of frames in which the zone has been executed.
+  std::size_t callCount {}; ///< Total number of executions in those frames.
+  double averageTime {}; ///< Average time spent in the zone per frame in which it has been executed, in milliseconds.
+  double minTime {}; ///< Minimum time spent in the zone in a frame, in milliseconds.
+  double maxTime {}; ///< Maximum time spent in the zone in a frame, in milliseconds.
+  double lastTime {}; ///< Time spent in the zone during the last frame, in milliseconds; 0 if it has not been executed.
+};
+
+/// Zone timing the scope it is declared in. Zones can be nested, & can be recorded from any thread without locking.
+/// This should be used through the RAZ_PROFILE_ZONE macro, which is compiled out if the profiler is disabled.
+class ScopedZone {
+public:
+  /// Enters a zone.
+  /// \param name Name of the zone. It must outlive the profiler's usage, which a string literal does.
+  explicit ScopedZone(const char* name) noexcept;
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone(ScopedZone&&) noexcept = delete;
+
+  ScopedZone& operator=(const ScopedZone&) = delete;
+  ScopedZone& operator=(ScopedZone&&) noexcept = delete;
+
+  /// Leaves the zone, recording its execution.
+  ~ScopedZone();
+
+private:
+  const char* m_name {};
+  ThreadBuffer* m_threadBuffer {};
+  uint64_t m_startTime {};
+};
+
+/// Ends the current frame, collecting the zones recorded by all threads since the last call to update the statistics.
+/// This should be called once per frame, from a single thread; the RAZ_PROFILE_FRAME macro can be used for this purpose.
+void endFrame();
+/// Sets the number of frames the statistics are computed over. It is 120 by default.
+/// \param frameCount Number of frames to keep; must be strictly positive.
+void setStatsFrameCount(std::size_t frameCount);
+/// Gets the statistics of all the zones executed over the last frames, sorted by decreasing average time.
+/// \return Statistics of each zone.
+std::vector<ZoneStats> getZoneStats();
+/// Checks if the zones collected at the end of each frame are kept in order to be exported.
+/// \return True if the zones are being captured, false otherwise.
+bool isCapturing();
+/// Starts keeping the zones collected at the end of each frame, in order to export them. The previous capture is discarded.
+void startCapture();
+/// Stops keeping the collected zones. The captured ones are kept until the next capture is started.
+void stopCapture();
+/// Gets the zones captured so far, in the order they have been collected.
+/// \return Captured zones.
+std::vector<ZoneEvent> getCapturedEvents();
+/// Exports the captured zones as a Chrome trace file, which can be opened with chrome://tracing or Perfetto.
+/// \param filePath Path to the JSON file to be written.
+void exportChromeTrace(const FilePath& filePath);
+/// Discards all the statistics & captured zones, as well as the zones recorded since the last frame.
+void clear();
+
+} // namespace Profiler
+
+} // namespace Raz
+
+#if defined(RAZ_USE_PROFILER)
+#define RAZ_PROFILE_CONCAT_IMPL(FIRST, SECOND) FIRST##SECOND
+#define RAZ_PROFILE_CONCAT(FIRST, SECOND) RAZ_PROFILE_CONCAT_IMPL(FIRST, SECOND)
+/// Times the current scope under the given name, which must be a string literal.
+#define RAZ_PROFILE_ZONE(NAME) const Raz::Profiler::ScopedZone RAZ_PROFILE_CONCAT(profileZone, __LINE__)(NAME)
+/// Ends the current profiled frame.
+#define RAZ_PROFILE_FRAME() Raz::Profiler::endFrame()
+#else
+#define RAZ_PROFILE_ZONE(NAME) static_cast<void>(0)
+#define RAZ_PROFILE_FRAME() static_cast<void>(0)
+#endif
+
+#endif // RAZ_PROFILER_HPP
@@ -77,6 +77,12 @@ public:
   /// \note If returns true with a negative hit distance, the ray is located inside the box & the hit position is the intersection point found behind the ray.
   /// \return True if the ray intersects the AABB, false otherwise.
   bool intersects(const AABB& aabb, RayHit* hit = nullptr) const;
+  /// Ray-AABB intersection check, only recovering the distance to the hit.
+  /// This avoids computing the hit's position & normal, which is useful when only ordering boxes along the ray.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param hitDistance Distance from the ray's origin to the closest intersection, negative if the origin is inside the box.
+  /// \return True if the ray intersects the AABB, false otherwise.
+  bool intersects(const AABB& aabb, float& hitDistance) const;
   /*
   /// Ray-OBB intersection check.
   /// \param obb OBB to check if there is an intersection with.
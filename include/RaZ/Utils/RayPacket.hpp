@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef RAZ_RAYPACKET_HPP
+#define RAZ_RAYPACKET_HPP
+
+#include "RaZ/Utils/Ray.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Raz {
+
+class AABB;
+class Triangle;
+
+/// Packet of rays stored in a structure of arrays layout, allowing to check several rays at once against a primitive.
+/// The intersections are computed with SSE (4 rays) or AVX (8 rays) instructions when available, and with a scalar
+///   fallback otherwise. Results are the same as checking each ray separately with Ray::intersects().
+/// \tparam Size Number of rays in the packet; must be either 4 or 8.
+template <std::size_t Size>
+class RayPacket {
+  static_assert(Size == 4 || Size == 8, "Error: A ray packet must hold either 4 or 8 rays.");
+
+public:
+  /// Creates a packet with all its rays inactive.
+  RayPacket() = default;
+  /// Creates a packet from the given rays. If less than Size rays are given, the remaining ones are inactive.
+  /// \param rays Rays to be added to the packet.
+  /// \param rayCount Number of rays to be added; must be less than or equal to Size.
+  RayPacket(const Ray* rays, std::size_t rayCount);
+
+  /// Gets the bits representing the active rays, the first ray being the least significant bit.
+  /// \return Active rays' bits.
+  uint32_t getActiveMask() const noexcept { return m_activeMask; }
+
+  /// Sets the ray at the given index, making it active.
+  /// \param rayIndex Index of the ray to be set; must be less than Size.
+  /// \param ray Ray to be set.
+  void setRay(std::size_t rayIndex, const Ray& ray);
+  /// Gets the ray at the given index, whether it is active or not.
+  /// \param rayIndex Index of the ray to be recovered; must be less than Size.
+  /// \return Ray at the given index.
+  Ray getRay(std::size_t rayIndex) const;
+  /// Deactivates all the rays of the packet.
+  void clear() noexcept { m_activeMask = 0; }
+
+  /// Rays-AABB intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param hitDistances Optional distances to the hits, only set for the rays intersecting the box (nullptr if unneeded).
+  ///   As with Ray::intersects(), a distance is negative if the ray's origin is inside the box.
+  /// \return Bits representing the active rays intersecting the box.
+  uint32_t intersects(const AABB& aabb, std::array<float, Size>* hitDistances = nullptr) const;
+  /// Rays-triangle intersection check.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \param hits Optional ray intersections' information, only set for the rays intersecting the triangle (nullptr if unneeded).
+  /// \return Bits representing the active rays intersecting the triangle.
+  uint32_t intersects(const Triangle& triangle, std::array<RayHit, Size>* hits = nullptr) const;
+
+private:
+  std::array<float, Size> m_originsX {};
+  std::array<float, Size> m_originsY {};
+  std::array<float, Size> m_originsZ {};
+  std::array<float, Size> m_directionsX {};
+  std::array<float, Size> m_directionsY {};
+  std::array<float, Size> m_directionsZ {};
+  std::array<float, Size> m_invDirectionsX {};
+  std::array<float, Size> m_invDirectionsY {};
+  std::array<float, Size> m_invDirectionsZ {};
+  uint32_t m_activeMask {};
+};
+
+using RayPacket4 = RayPacket<4>;
+using RayPacket8 = RayPacket<8>;
+
+/// Packet of AABBs stored in a structure of arrays layout, allowing to check a ray against several boxes at once.
+/// \see RayPacket
+/// \tparam Size Number of boxes in the packet; must be either 4 or 8.
+template <std::size_t Size>
+class AABBPacket {
+  static_assert(Size == 4 || Size == 8, "Error: An AABB packet must hold either 4 or 8 boxes.");
+
+public:
+  /// Creates a packet with all its boxes inactive.
+  AABBPacket() = default;
+  /// Creates a packet from the given boxes. If less than Size boxes are given, the remaining ones are inactive.
+  /// \param boxes Boxes to be added to the packet.
+  /// \param boxCount Number of boxes to be added; must be less than or equal to Size.
+  AABBPacket(const AABB* boxes, std::size_t boxCount);
+
+  /// Gets the bits representing the active boxes, the first box being the least significant bit.
+  /// \return Active boxes' bits.
+  uint32_t getActiveMask() const noexcept { return m_activeMask; }
+
+  /// Sets the box at the given index, making it active.
+  /// \param boxIndex Index of the box to be set; must be less than Size.
+  /// \param box Box to be set.
+  void setBox(std::size_t boxIndex, const AABB& box);
+  /// Deactivates all the boxes of the packet.
+  void clear() noexcept { m_activeMask = 0; }
+
+  /// Ray-AABBs intersection check.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hitDistances Optional distances to the hits, only set for the boxes intersected by the ray (nullptr if unneeded).
+  ///   As with Ray::intersects(), a distance is negative if the ray's origin is inside the box.
+  /// \return Bits representing the active boxes intersected by the ray.
+  uint32_t intersects(const Ray& ray, std::array<float, Size>* hitDistances = nullptr) const;
+
+private:
+  std::array<float, Size> m_minPositionsX {};
+  std::array<float, Size> m_minPositionsY {};
+  std::array<float, Size> m_minPositionsZ {};
+  std::array<float, Size> m_maxPositionsX {};
+  std::array<float, Size> m_maxPositionsY {};
+  std::array<float, Size> m_maxPositionsZ {};
+  uint32_t m_activeMask {};
+};
+
+using AABBPacket4 = AABBPacket<4>;
+using AABBPacket8 = AABBPacket<8>;
+
+} // namespace Raz
+
+#endif // RAZ_RAYPACKET_HPP
@@ -81,6 +81,9 @@ public:
   /// Computes the shape's centroid.
   /// \return Computed centroid.
   virtual Vec3f computeCentroid() const = 0;
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  virtual AABB computeBoundingBox() const = 0;
 
   Shape& operator=(const Shape&) = default;
   Shape& operator=(Shape&&) noexcept = default;
@@ -145,6 +148,9 @@ public:
   /// Computes the line's centroid, which is the point lying directly between the two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_beginPos + m_endPos) * 0.5f; }
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
   /// Line length computation.
   /// To be used if the actual length is needed; otherwise, prefer computeSquaredLength().
   /// \return Line's length.
@@ -217,6 +223,10 @@ public:
   /// Computes the plane's centroid, which is the point lying onto the plane at its distance from the center in its normal direction.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_normal * m_distance; }
+  /// Computes the smallest axis-aligned box containing the whole plane.
+  /// \note Since a plane is infinite, its bounding box is infinite as well.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
 
 private:
   float m_distance {};
@@ -277,6 +287,9 @@ public:
   /// Computes the sphere's centroid, which is its center. Strictly equivalent to getCenterPos().
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_centerPos; }
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
 
 private:
   Vec3f m_centerPos {};
@@ -339,6 +352,9 @@ public:
   /// Computes the triangle's centroid, which is the point lying directly between its three points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_firstPos + m_secondPos + m_thirdPos) / 3.f; }
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
   /// Computes the triangle's normal from its points.
   /// \return Computed normal.
   Vec3f computeNormal() const;
@@ -413,6 +429,9 @@ public:
   /// Computes the quad's centroid, which is the point lying directly between its four points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_leftTopPos + m_rightTopPos + m_rightBottomPos + m_leftBottomPos) * 0.25f; }
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
 
 private:
   Vec3f m_leftTopPos {};
@@ -502,6 +521,9 @@ public:
   /// Computes the AABB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_rightTopFrontPos + m_leftBottomBackPos) * 0.5f; }
+  /// Computes the smallest axis-aligned box containing the whole shape, which is the AABB itself.
+  /// \return Copy of the AABB.
+  AABB computeBoundingBox() const override { return *this; }
   /// Computes the half extents of the box, starting from its centroid.
   ///
   ///          _______________________
@@ -628,6 +650,9 @@ public:
   /// Computes the OBB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_aabb.computeCentroid(); }
+  /// Computes the smallest axis-aligned box containing the whole shape.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
   /// Computes the half extents of the box, starting from its centroid.
   /// These half extents are oriented according to the box's rotation.
   ///
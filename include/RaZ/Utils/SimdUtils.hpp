@@ -0,0 +1,365 @@
+#pragma once
+
+#ifndef RAZ_SIMDUTILS_HPP
+#define RAZ_SIMDUTILS_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+// Detecting the available instruction sets from the compiler's target; these are not checked at runtime
+#if defined(__AVX__)
+#define RAZ_SIMD_AVX
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAZ_SIMD_SSE
+#endif
+
+#if defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define RAZ_SIMD_NEON
+#endif
+
+#if defined(RAZ_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(RAZ_SIMD_SSE)
+#include <emmintrin.h>
+#elif defined(RAZ_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+// Vectorized functions can't be evaluated at compile time; constexpr functions can only use them if the compiler is able to tell
+//  whether they are being evaluated at compile time or at runtime. Otherwise, only the generic implementations are used
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define RAZ_HAS_CONSTANT_EVALUATION_CHECK
+#endif
+#endif
+
+#if !defined(RAZ_HAS_CONSTANT_EVALUATION_CHECK) && ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define RAZ_HAS_CONSTANT_EVALUATION_CHECK
+#endif
+
+#if defined(RAZ_HAS_CONSTANT_EVALUATION_CHECK) && (defined(RAZ_SIMD_SSE) || defined(RAZ_SIMD_NEON))
+#define RAZ_SIMD_CONSTEXPR_DISPATCH
+#endif
+
+namespace Raz {
+
+namespace SimdUtils {
+
+/// Checks if vectorized functions can be called from a constexpr one, which is the case if it is evaluated at runtime & if
+///   4-lane packs are backed by an instruction set.
+/// \return True if vectorized functions can be called, false otherwise.
+constexpr bool canVectorize() noexcept {
+#if defined(RAZ_SIMD_CONSTEXPR_DISPATCH)
+  return !__builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+/// Result of a comparison between packs, holding one boolean per lane.
+/// This generic version is used when no instruction set is available for the given size.
+/// \tparam Size Number of lanes.
+template <std::size_t Size>
+class MaskPack {
+  static_assert(Size <= 32, "Error: A mask pack can hold at most 32 lanes.");
+
+public:
+  static constexpr uint32_t AllBits = (Size == 32 ? ~0u : (1u << Size) - 1);
+
+  constexpr explicit MaskPack(uint32_t bits) noexcept : m_bits{ bits & AllBits } {}
+
+  /// Gets the mask's lanes as bits, the first lane being the least significant bit.
+  /// \return Lanes' bits.
+  constexpr uint32_t getBits() const noexcept { return m_bits; }
+
+  constexpr MaskPack operator~() const noexcept { return MaskPack(~m_bits); }
+  constexpr MaskPack operator&(MaskPack mask) const noexcept { return MaskPack(m_bits & mask.m_bits); }
+  constexpr MaskPack operator|(MaskPack mask) const noexcept { return MaskPack(m_bits | mask.m_bits); }
+
+private:
+  uint32_t m_bits {};
+};
+
+/// Pack of floating-point values, on which each operation is applied to all lanes at once.
+/// This generic version is used when no instruction set is available for the given size; it is made of simple loops which
+///   the compiler may still vectorize.
+/// \note Minimum & maximum follow the same rules as std::min() & std::max(), returning the first argument when either is NaN.
+/// \tparam Size Number of lanes.
+template <std::size_t Size>
+class FloatPack {
+public:
+  FloatPack() = default;
+  explicit FloatPack(float value) noexcept { m_values.fill(value); }
+
+  /// Loads a pack from memory; the values do not need to be aligned.
+  /// \param values Values to be loaded; must point to at least Size values.
+  /// \return Loaded pack.
+  static FloatPack load(const float* values) noexcept {
+    FloatPack res;
+    for (std::size_t i = 0; i < Size; ++i)
+      res.m_values[i] = values[i];
+    return res;
+  }
+
+  /// Stores the pack into memory; the destination does not need to be aligned.
+  /// \param values Values to be written to; must point to at least Size values.
+  void store(float* values) const noexcept {
+    for (std::size_t i = 0; i < Size; ++i)
+      values[i] = m_values[i];
+  }
+
+  /// Creates a pack from lanes of two others: its first two lanes are taken from the first pack, its last two from the second.
+  /// \tparam I0 Index of the first pack's lane to be put in the first lane.
+  /// \tparam I1 Index of the first pack's lane to be put in the second lane.
+  /// \tparam I2 Index of the second pack's lane to be put in the third lane.
+  /// \tparam I3 Index of the second pack's lane to be put in the fourth lane.
+  /// \param pack1 Pack to take the first two lanes from.
+  /// \param pack2 Pack to take the last two lanes from.
+  /// \return Shuffled pack.
+  template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+  static FloatPack shuffle(const FloatPack& pack1, const FloatPack& pack2) noexcept {
+    static_assert(Size == 4, "Error: Only packs of 4 lanes can be shuffled.");
+    static_assert(I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Error: Shuffled lane indices must be less than 4.");
+
+    FloatPack res;
+    res.m_values[0] = pack1.m_values[I0];
+    res.m_values[1] = pack1.m_values[I1];
+    res.m_values[2] = pack2.m_values[I2];
+    res.m_values[3] = pack2.m_values[I3];
+    return res;
+  }
+
+  friend FloatPack operator+(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return a + b; }); }
+  friend FloatPack operator-(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return a - b; }); }
+  friend FloatPack operator*(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return a * b; }); }
+  friend FloatPack operator/(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return a / b; }); }
+  friend FloatPack min(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return (b < a ? b : a); }); }
+  friend FloatPack max(const FloatPack& pack1, const FloatPack& pack2) noexcept { return apply(pack1, pack2, [] (float a, float b) { return (a < b ? b : a); }); }
+  friend FloatPack abs(const FloatPack& pack) noexcept { return apply(pack, pack, [] (float a, float) { return (a < 0.f ? -a : a); }); }
+
+  friend MaskPack<Size> operator<(const FloatPack& pack1, const FloatPack& pack2) noexcept { return compare(pack1, pack2, [] (float a, float b) { return a < b; }); }
+  friend MaskPack<Size> operator<=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return compare(pack1, pack2, [] (float a, float b) { return a <= b; }); }
+  friend MaskPack<Size> operator>(const FloatPack& pack1, const FloatPack& pack2) noexcept { return compare(pack1, pack2, [] (float a, float b) { return a > b; }); }
+  friend MaskPack<Size> operator>=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return compare(pack1, pack2, [] (float a, float b) { return a >= b; }); }
+
+  /// Transposes the 4x4 matrix whose rows are the given packs.
+  friend void transpose(FloatPack& row0, FloatPack& row1, FloatPack& row2, FloatPack& row3) noexcept {
+    static_assert(Size == 4, "Error: Only packs of 4 lanes can be transposed.");
+
+    for (std::size_t i = 0; i < Size; ++i) {
+      for (std::size_t j = i + 1; j < Size; ++j)
+        std::swap(getRow(row0, row1, row2, row3, i).m_values[j], getRow(row0, row1, row2, row3, j).m_values[i]);
+    }
+  }
+
+private:
+  static FloatPack& getRow(FloatPack& row0, FloatPack& row1, FloatPack& row2, FloatPack& row3, std::size_t rowIndex) noexcept {
+    return (rowIndex == 0 ? row0 : (rowIndex == 1 ? row1 : (rowIndex == 2 ? row2 : row3)));
+  }
+
+  template <typename Func>
+  static FloatPack apply(const FloatPack& pack1, const FloatPack& pack2, Func&& func) noexcept {
+    FloatPack res;
+    for (std::size_t i = 0; i < Size; ++i)
+      res.m_values[i] = func(pack1.m_values[i], pack2.m_values[i]);
+    return res;
+  }
+
+  template <typename Func>
+  static MaskPack<Size> compare(const FloatPack& pack1, const FloatPack& pack2, Func&& func) noexcept {
+    uint32_t bits = 0;
+    for (std::size_t i = 0; i < Size; ++i)
+      bits |= static_cast<uint32_t>(func(pack1.m_values[i], pack2.m_values[i])) << i;
+    return MaskPack<Size>(bits);
+  }
+
+  std::array<float, Size> m_values {};
+};
+
+#if defined(RAZ_SIMD_SSE)
+template <>
+class MaskPack<4> {
+public:
+  static constexpr uint32_t AllBits = 0b1111;
+
+  explicit MaskPack(__m128 mask) noexcept : m_mask{ mask } {}
+
+  uint32_t getBits() const noexcept { return static_cast<uint32_t>(_mm_movemask_ps(m_mask)); }
+
+  MaskPack operator~() const noexcept { return MaskPack(_mm_xor_ps(m_mask, _mm_castsi128_ps(_mm_set1_epi32(-1)))); }
+  MaskPack operator&(MaskPack mask) const noexcept { return MaskPack(_mm_and_ps(m_mask, mask.m_mask)); }
+  MaskPack operator|(MaskPack mask) const noexcept { return MaskPack(_mm_or_ps(m_mask, mask.m_mask)); }
+
+private:
+  __m128 m_mask;
+};
+
+template <>
+class FloatPack<4> {
+public:
+  FloatPack() noexcept : m_values{ _mm_setzero_ps() } {}
+  explicit FloatPack(float value) noexcept : m_values{ _mm_set1_ps(value) } {}
+  explicit FloatPack(__m128 values) noexcept : m_values{ values } {}
+
+  static FloatPack load(const float* values) noexcept { return FloatPack(_mm_loadu_ps(values)); }
+  void store(float* values) const noexcept { _mm_storeu_ps(values, m_values); }
+
+  template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+  static FloatPack shuffle(const FloatPack& pack1, const FloatPack& pack2) noexcept {
+    static_assert(I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Error: Shuffled lane indices must be less than 4.");
+    return FloatPack(_mm_shuffle_ps(pack1.m_values, pack2.m_values, _MM_SHUFFLE(I3, I2, I1, I0)));
+  }
+
+  friend FloatPack operator+(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_add_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator-(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_sub_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator*(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_mul_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator/(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_div_ps(pack1.m_values, pack2.m_values)); }
+  // The SSE min/max instructions return their second operand if either is NaN; swapping them matches std::min() & std::max()
+  friend FloatPack min(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_min_ps(pack2.m_values, pack1.m_values)); }
+  friend FloatPack max(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm_max_ps(pack2.m_values, pack1.m_values)); }
+  friend FloatPack abs(const FloatPack& pack) noexcept { return FloatPack(_mm_andnot_ps(_mm_set1_ps(-0.f), pack.m_values)); }
+
+  friend MaskPack<4> operator<(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(_mm_cmplt_ps(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator<=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(_mm_cmple_ps(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator>(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(_mm_cmpgt_ps(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator>=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(_mm_cmpge_ps(pack1.m_values, pack2.m_values)); }
+
+  /// Transposes the 4x4 matrix whose rows are the given packs.
+  friend void transpose(FloatPack& row0, FloatPack& row1, FloatPack& row2, FloatPack& row3) noexcept {
+    _MM_TRANSPOSE4_PS(row0.m_values, row1.m_values, row2.m_values, row3.m_values);
+  }
+
+private:
+  __m128 m_values;
+};
+#elif defined(RAZ_SIMD_NEON)
+template <>
+class MaskPack<4> {
+public:
+  static constexpr uint32_t AllBits = 0b1111;
+
+  explicit MaskPack(uint32x4_t mask) noexcept : m_mask{ mask } {}
+
+  uint32_t getBits() const noexcept {
+    const uint32x4_t laneBits = vandq_u32(m_mask, uint32x4_t{ 1, 2, 4, 8 });
+    return vaddvq_u32(laneBits);
+  }
+
+  MaskPack operator~() const noexcept { return MaskPack(vmvnq_u32(m_mask)); }
+  MaskPack operator&(MaskPack mask) const noexcept { return MaskPack(vandq_u32(m_mask, mask.m_mask)); }
+  MaskPack operator|(MaskPack mask) const noexcept { return MaskPack(vorrq_u32(m_mask, mask.m_mask)); }
+
+private:
+  uint32x4_t m_mask;
+};
+
+template <>
+class FloatPack<4> {
+public:
+  FloatPack() noexcept : m_values{ vdupq_n_f32(0.f) } {}
+  explicit FloatPack(float value) noexcept : m_values{ vdupq_n_f32(value) } {}
+  explicit FloatPack(float32x4_t values) noexcept : m_values{ values } {}
+
+  static FloatPack load(const float* values) noexcept { return FloatPack(vld1q_f32(values)); }
+  void store(float* values) const noexcept { vst1q_f32(values, m_values); }
+
+  template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+  static FloatPack shuffle(const FloatPack& pack1, const FloatPack& pack2) noexcept {
+    static_assert(I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Error: Shuffled lane indices must be less than 4.");
+
+    float32x4_t res = vdupq_n_f32(vgetq_lane_f32(pack1.m_values, I0));
+    res = vsetq_lane_f32(vgetq_lane_f32(pack1.m_values, I1), res, 1);
+    res = vsetq_lane_f32(vgetq_lane_f32(pack2.m_values, I2), res, 2);
+    res = vsetq_lane_f32(vgetq_lane_f32(pack2.m_values, I3), res, 3);
+    return FloatPack(res);
+  }
+
+  friend FloatPack operator+(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(vaddq_f32(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator-(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(vsubq_f32(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator*(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(vmulq_f32(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator/(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(vdivq_f32(pack1.m_values, pack2.m_values)); }
+  // Selecting explicitly from comparisons, since the NEON min/max instructions propagate NaNs instead of matching std::min() & std::max()
+  friend FloatPack min(const FloatPack& pack1, const FloatPack& pack2) noexcept {
+    return FloatPack(vbslq_f32(vcltq_f32(pack2.m_values, pack1.m_values), pack2.m_values, pack1.m_values));
+  }
+  friend FloatPack max(const FloatPack& pack1, const FloatPack& pack2) noexcept {
+    return FloatPack(vbslq_f32(vcltq_f32(pack1.m_values, pack2.m_values), pack2.m_values, pack1.m_values));
+  }
+  friend FloatPack abs(const FloatPack& pack) noexcept { return FloatPack(vabsq_f32(pack.m_values)); }
+
+  friend MaskPack<4> operator<(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(vcltq_f32(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator<=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(vcleq_f32(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator>(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(vcgtq_f32(pack1.m_values, pack2.m_values)); }
+  friend MaskPack<4> operator>=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<4>(vcgeq_f32(pack1.m_values, pack2.m_values)); }
+
+  /// Transposes the 4x4 matrix whose rows are the given packs.
+  friend void transpose(FloatPack& row0, FloatPack& row1, FloatPack& row2, FloatPack& row3) noexcept {
+    const float32x4x2_t firstRows = vtrnq_f32(row0.m_values, row1.m_values);
+    const float32x4x2_t lastRows  = vtrnq_f32(row2.m_values, row3.m_values);
+
+    row0.m_values = vcombine_f32(vget_low_f32(firstRows.val[0]), vget_low_f32(lastRows.val[0]));
+    row1.m_values = vcombine_f32(vget_low_f32(firstRows.val[1]), vget_low_f32(lastRows.val[1]));
+    row2.m_values = vcombine_f32(vget_high_f32(firstRows.val[0]), vget_high_f32(lastRows.val[0]));
+    row3.m_values = vcombine_f32(vget_high_f32(firstRows.val[1]), vget_high_f32(lastRows.val[1]));
+  }
+
+private:
+  float32x4_t m_values;
+};
+#endif
+
+#if defined(RAZ_SIMD_AVX)
+template <>
+class MaskPack<8> {
+public:
+  static constexpr uint32_t AllBits = 0b11111111;
+
+  explicit MaskPack(__m256 mask) noexcept : m_mask{ mask } {}
+
+  uint32_t getBits() const noexcept { return static_cast<uint32_t>(_mm256_movemask_ps(m_mask)); }
+
+  MaskPack operator~() const noexcept { return MaskPack(_mm256_xor_ps(m_mask, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))); }
+  MaskPack operator&(MaskPack mask) const noexcept { return MaskPack(_mm256_and_ps(m_mask, mask.m_mask)); }
+  MaskPack operator|(MaskPack mask) const noexcept { return MaskPack(_mm256_or_ps(m_mask, mask.m_mask)); }
+
+private:
+  __m256 m_mask;
+};
+
+template <>
+class FloatPack<8> {
+public:
+  FloatPack() noexcept : m_values{ _mm256_setzero_ps() } {}
+  explicit FloatPack(float value) noexcept : m_values{ _mm256_set1_ps(value) } {}
+  explicit FloatPack(__m256 values) noexcept : m_values{ values } {}
+
+  static FloatPack load(const float* values) noexcept { return FloatPack(_mm256_loadu_ps(values)); }
+  void store(float* values) const noexcept { _mm256_storeu_ps(values, m_values); }
+
+  friend FloatPack operator+(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_add_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator-(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_sub_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator*(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_mul_ps(pack1.m_values, pack2.m_values)); }
+  friend FloatPack operator/(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_div_ps(pack1.m_values, pack2.m_values)); }
+  // The AVX min/max instructions return their second operand if either is NaN; swapping them matches std::min() & std::max()
+  friend FloatPack min(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_min_ps(pack2.m_values, pack1.m_values)); }
+  friend FloatPack max(const FloatPack& pack1, const FloatPack& pack2) noexcept { return FloatPack(_mm256_max_ps(pack2.m_values, pack1.m_values)); }
+  friend FloatPack abs(const FloatPack& pack) noexcept { return FloatPack(_mm256_andnot_ps(_mm256_set1_ps(-0.f), pack.m_values)); }
+
+  friend MaskPack<8> operator<(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<8>(_mm256_cmp_ps(pack1.m_values, pack2.m_values, _CMP_LT_OQ)); }
+  friend MaskPack<8> operator<=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<8>(_mm256_cmp_ps(pack1.m_values, pack2.m_values, _CMP_LE_OQ)); }
+  friend MaskPack<8> operator>(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<8>(_mm256_cmp_ps(pack1.m_values, pack2.m_values, _CMP_GT_OQ)); }
+  friend MaskPack<8> operator>=(const FloatPack& pack1, const FloatPack& pack2) noexcept { return MaskPack<8>(_mm256_cmp_ps(pack1.m_values, pack2.m_values, _CMP_GE_OQ)); }
+
+private:
+  __m256 m_values;
+};
+#endif
+
+} // namespace SimdUtils
+
+} // namespace Raz
+
+#endif // RAZ_SIMDUTILS_HPP
@@ -12,9 +12,16 @@
 
 #if defined(RAZ_THREADS_AVAILABLE)
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 namespace Raz::Threading {
 
@@ -46,11 +53,122 @@ private:
 /// \return Number of threads available.
 unsigned int getSystemThreadCount() noexcept;
 
+/// Pool of persistent worker threads, to which tasks can be submitted without paying the cost of creating threads.
+/// Each worker has its own task queue; a worker having nothing left to execute steals tasks from the others.
+class ThreadPool {
+  friend class TaskGroup;
+
+public:
+  /// Creates a thread pool, starting its workers.
+  /// \param threadCount Number of worker threads to start; must be strictly positive.
+  explicit ThreadPool(std::size_t threadCount = getSystemThreadCount());
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) noexcept = delete;
+
+  std::size_t getThreadCount() const noexcept { return m_workers.size(); }
+
+  /// Submits a task to be executed by one of the workers.
+  /// \tparam Func Type of the task to be executed.
+  /// \tparam Args Types of the arguments to be forwarded to the task.
+  /// \tparam ResultType Return type of the task.
+  /// \param task Task to be executed.
+  /// \param args Arguments to be forwarded to the task.
+  /// \return A std::future holding the future result of the task, or the exception it has thrown.
+  template <typename Func, typename... Args, typename ResultType = std::invoke_result_t<std::decay_t<Func>, std::decay_t<Args>...>>
+  [[nodiscard]] std::future<ResultType> submit(Func&& task, Args&&... args);
+  /// Calls a function on all the indices in the given range, split into several tasks executed in parallel.
+  /// The calling thread takes part in the execution, & returns once all indices have been processed.
+  /// \tparam Func Type of the function to be called.
+  /// \param beginIndex First index of the range.
+  /// \param endIndex Index past the last one of the range.
+  /// \param action Function to be called for each task, giving the index range it must process.
+  /// \param grainSize Number of indices processed by each task. If 0, it is computed so that each worker gets a few tasks.
+  template <typename Func>
+  void parallelFor(std::size_t beginIndex, std::size_t endIndex, Func&& action, std::size_t grainSize = 0);
+  /// Executes one pending task on the calling thread, if any. This allows threads waiting for tasks to help completing them.
+  /// \return True if a task has been executed, false if none was available.
+  bool runPendingTask();
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+  /// Destroys the thread pool, after all its pending tasks have been executed.
+  ~ThreadPool();
+
+private:
+  using Task = std::function<void()>;
+
+  struct Worker {
+    std::deque<Task> tasks {};
+    std::mutex mutex {};
+    std::thread thread {};
+  };
+
+  /// Adds a task to be executed. If called from one of the pool's workers, the task is added to this worker's own queue.
+  /// \param task Task to be added.
+  void enqueue(Task task);
+  /// Takes the most recently added task from the given worker's queue.
+  /// \param workerIndex Index of the worker to take the task from.
+  /// \param task Taken task, if any.
+  /// \return True if a task has been taken, false otherwise.
+  bool popTask(std::size_t workerIndex, Task& task);
+  /// Takes the oldest task from the first other worker which has any.
+  /// \param thiefIndex Index of the worker stealing the task; the search begins with the next one.
+  /// \param task Stolen task, if any.
+  /// \return True if a task has been stolen, false otherwise.
+  bool stealTask(std::size_t thiefIndex, Task& task);
+  /// Executes tasks until the pool is destroyed, waiting for new ones when none is available.
+  /// \param workerIndex Index of the worker running the loop.
+  void runWorker(std::size_t workerIndex);
+
+  std::vector<std::unique_ptr<Worker>> m_workers {};
+  std::atomic<std::size_t> m_pendingTaskCount = 0;
+  std::atomic<std::size_t> m_nextWorkerIndex = 0; ///< Worker to which the next task submitted from outside of the pool will be given.
+  std::mutex m_wakeMutex {};
+  std::condition_variable m_wakeCondition {};
+  bool m_isStopping = false;
+};
+
+/// Gets the thread pool shared by the whole application, which is created on the first call.
+/// \return Reference to the default thread pool.
+ThreadPool& getDefaultThreadPool();
+
+/// Group of tasks executed by a thread pool, which can be waited for all at once.
+class TaskGroup {
+public:
+  explicit TaskGroup(ThreadPool& threadPool = getDefaultThreadPool()) : m_threadPool{ threadPool } {}
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup(TaskGroup&&) noexcept = delete;
+
+  /// Adds a task to the group, executed as soon as a worker is available.
+  /// \tparam Func Type of the task to be executed.
+  /// \param task Task to be executed.
+  template <typename Func> void run(Func&& task);
+  /// Waits for all the group's tasks to be completed. The calling thread executes pending tasks in the meantime.
+  /// If any task has thrown an exception, the first one is rethrown.
+  void wait();
+
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  TaskGroup& operator=(TaskGroup&&) noexcept = delete;
+
+  /// Destroys the group, waiting for its remaining tasks to be completed; their exceptions are then discarded.
+  ~TaskGroup();
+
+private:
+  /// Waits for all the group's tasks to be completed, executing pending tasks in the meantime.
+  void waitForTasks() noexcept;
+
+  ThreadPool& m_threadPool;
+  std::atomic<std::size_t> m_pendingTaskCount = 0;
+  std::exception_ptr m_exception {};
+  std::mutex m_exceptionMutex {};
+};
+
 /// Pauses the current thread for the specified amount of time.
 /// \param milliseconds Pause duration in milliseconds.
 inline void sleep(uint64_t milliseconds) { std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds)); }
 
-/// Calls a function asynchronously, to be executed without blocking the calling thread.
+/// Calls a function asynchronously on the default thread pool, to be executed without blocking the calling thread.
 /// \tparam Func Function to be called.
 /// \tparam Args Types of the arguments to be forwarded to the given function.
 /// \tparam ResultType Return type of the given function.
@@ -61,6 +179,8 @@ template <typename Func, typename... Args, typename ResultType = std::invoke_res
 [[nodiscard]] std::future<ResultType> launchAsync(Func&& action, Args&&... args);
 
 /// Calls a function in parallel on a given number of separate threads of execution.
+/// \note The instances are executed by the default thread pool, & are thus not guaranteed to all run simultaneously;
+///   they must not wait for each other.
 /// \param action Action to be performed by each thread.
 /// \param threadCount Amount of threads to start an instance on.
 void parallelize(const std::function<void()>& action, std::size_t threadCount = getSystemThreadCount());
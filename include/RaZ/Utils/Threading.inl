@@ -1,58 +1,124 @@
+#include <algorithm>
 #include <cassert>
+#include <tuple>
 #include <vector>
 
 namespace Raz::Threading {
 
+template <typename Func, typename... Args, typename ResultType>
+std::future<ResultType> ThreadPool::submit(Func&& task, Args&&... args) {
+  // std::function requires copyable functions; the packaged task, which is not, is thus shared
+  auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>([func = std::forward<Func>(task),
+                                                                           funcArgs = std::make_tuple(std::forward<Args>(args)...)] () mutable {
+    return std::apply(std::move(func), std::move(funcArgs));
+  });
+
+  std::future<ResultType> result = packagedTask->get_future();
+  enqueue([packagedTask = std::move(packagedTask)] () { (*packagedTask)(); });
+
+  return result;
+}
+
+template <typename Func>
+void ThreadPool::parallelFor(std::size_t beginIndex, std::size_t endIndex, Func&& action, std::size_t grainSize) {
+  if (beginIndex >= endIndex)
+    return;
+
+  const std::size_t indexCount = endIndex - beginIndex;
+
+  // Giving several tasks to each worker (& to the calling thread) helps balancing the load when they don't take the same time
+  if (grainSize == 0)
+    grainSize = std::max(indexCount / ((m_workers.size() + 1) * 4), static_cast<std::size_t>(1));
+
+  TaskGroup taskGroup(*this);
+  std::size_t taskBeginIndex = beginIndex;
+
+  for (; endIndex - taskBeginIndex > grainSize; taskBeginIndex += grainSize) {
+    taskGroup.run([&action, taskBeginIndex, grainSize] () {
+      action(IndexRange{ taskBeginIndex, taskBeginIndex + grainSize });
+    });
+  }
+
+  // The last range is processed by the calling thread, which would otherwise just be waiting
+  action(IndexRange{ taskBeginIndex, endIndex });
+  taskGroup.wait();
+}
+
+template <typename Func>
+void TaskGroup::run(Func&& task) {
+  m_pendingTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+  m_threadPool.enqueue([this, task = std::forward<Func>(task)] () mutable {
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_exceptionMutex);
+
+      if (!m_exception)
+        m_exception = std::current_exception();
+    }
+
+    // The group may be destroyed as soon as its last task is completed; it must not be accessed after this
+    m_pendingTaskCount.fetch_sub(1, std::memory_order_release);
+  });
+}
+
 template <typename Func, typename... Args, typename ResultType>
 std::future<ResultType> launchAsync(Func&& action, Args&&... args) {
-  return std::async(std::forward<Func>(action), std::forward<Args>(args)...);
+  return getDefaultThreadPool().submit(std::forward<Func>(action), std::forward<Args>(args)...);
 }
 
 template <typename ContainerType, typename Func, typename>
 void parallelize(const ContainerType& collection, Func&& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
-  std::vector<std::thread> threads(std::min(threadCount, std::size(collection)));
+  const std::size_t taskCount = std::min(threadCount, std::size(collection));
+
+  if (taskCount == 0)
+    return;
 
   // This performs a mathematical round: if the result of the division gives a number below X.5, ceil it; otherwise, round it
   const std::size_t rangeCount = (std::size(collection) + threadCount / 2) / threadCount;
 
-  std::size_t beginIndex = 0;
-  std::size_t endIndex   = rangeCount;
+  TaskGroup taskGroup;
 
-  // Creating one thread per slice, minus one to avoid getting one more element in the last thread if the size is indivisible
-  for (std::size_t threadIndex = 0; threadIndex < threads.size() - 1; ++threadIndex) {
-    threads[threadIndex] = std::thread(action, IndexRange{ beginIndex, endIndex });
+  for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex) {
+    // The last task gets the remaining elements, which may be fewer or more than the others' if the size is indivisible
+    const std::size_t beginIndex = std::min(rangeCount * taskIndex, std::size(collection));
+    const std::size_t endIndex   = (taskIndex == taskCount - 1 ? std::size(collection) : std::min(beginIndex + rangeCount, std::size(collection)));
 
-    beginIndex = endIndex;
-    endIndex  += rangeCount;
+    taskGroup.run([&action, beginIndex, endIndex] () { action(IndexRange{ beginIndex, endIndex }); });
   }
 
-  // The last thread is created independently with just the remaining number of elements
-  threads.back() = std::thread(action, IndexRange{ beginIndex, std::min(endIndex, std::size(collection)) });
-
-  for (std::thread& thread : threads)
-    thread.join();
+  taskGroup.wait();
 }
 
 template <typename ContainerType, typename Func, typename>
 void parallelize(ContainerType& collection, Func&& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
-  std::vector<std::thread> threads(std::min(threadCount, std::size(collection)));
+  const std::size_t taskCount = std::min(threadCount, std::size(collection));
+
+  if (taskCount == 0)
+    return;
 
   // This performs a mathematical round: if the result of the division gives a number below X.5, ceil it; otherwise, round it
   const std::size_t rangeCount = (std::size(collection) + threadCount / 2) / threadCount;
 
-  for (std::size_t threadIndex = 0; threadIndex < threads.size(); ++threadIndex) {
-    typename ContainerType::iterator beginIter = std::begin(collection) + rangeCount * threadIndex;
-    typename ContainerType::iterator endIter   = beginIter + rangeCount;
+  TaskGroup taskGroup;
+
+  for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex) {
+    // The last task gets the remaining elements, which may be fewer or more than the others' if the size is indivisible
+    const std::size_t beginIndex = std::min(rangeCount * taskIndex, std::size(collection));
+    const std::size_t endIndex   = (taskIndex == taskCount - 1 ? std::size(collection) : std::min(beginIndex + rangeCount, std::size(collection)));
+
+    typename ContainerType::iterator beginIter = std::begin(collection) + static_cast<std::ptrdiff_t>(beginIndex);
+    typename ContainerType::iterator endIter   = std::begin(collection) + static_cast<std::ptrdiff_t>(endIndex);
 
-    threads[threadIndex] = std::thread(action, IterRange<ContainerType>(beginIter, endIter));
+    taskGroup.run([&action, beginIter, endIter] () { action(IterRange<ContainerType>(beginIter, endIter)); });
   }
 
-  for (std::thread& thread : threads)
-    thread.join();
+  taskGroup.wait();
 }
 
 } // namespace Raz::Threading
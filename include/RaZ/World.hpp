@@ -4,20 +4,123 @@
 #define RAZ_WORLD_HPP
 
 #include "RaZ/Entity.hpp"
+#include "RaZ/EntityQuery.hpp"
 #include "RaZ/System.hpp"
+#include "RaZ/SystemGraph.hpp"
+
+#include <functional>
+#include <limits>
+#include <mutex>
 
 namespace Raz {
 
 /// World class handling systems & entities.
 class World {
+  friend Entity;
+
 public:
+  /// Buffer recording structural changes (entities & components being added, removed, enabled or disabled) to be applied later.
+  /// Each thread records into its own buffer, which requires no synchronization; all buffers are played back at the beginning
+  ///   of the next world update, before the entities are refreshed. This allows systems updated concurrently to modify the world
+  ///   without altering the entities being iterated over.
+  class CommandBuffer {
+    friend World;
+
+  public:
+    /// Reference to an entity whose creation has been recorded into a buffer, usable only in the same buffer's commands.
+    struct PendingEntity {
+      std::size_t index {};
+    };
+
+    CommandBuffer() = default;
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer(CommandBuffer&&) noexcept = default;
+
+    std::size_t getCommandCount() const noexcept { return m_commands.size(); }
+    bool isEmpty() const noexcept { return m_commands.empty(); }
+
+    /// Records the addition of an entity into the world.
+    /// \param enabled True if the entity should be active once added, false otherwise.
+    /// \return Reference to the entity to be created, which can be given to the next commands of this buffer.
+    PendingEntity addEntity(bool enabled = true);
+    /// Records the addition of a component into an existing entity. If the entity has been removed meanwhile, this does nothing.
+    /// \tparam Comp Type of the component to be added.
+    /// \tparam Args Types of the arguments to be forwarded to the component; they are copied into the buffer.
+    /// \param handle Handle of the entity to add the component to.
+    /// \param args Arguments to be forwarded to the component.
+    template <typename Comp, typename... Args> void addComponent(const EntityHandle& handle, Args&&... args);
+    /// Records the addition of a component into an entity whose creation has been recorded beforehand.
+    /// \tparam Comp Type of the component to be added.
+    /// \tparam Args Types of the arguments to be forwarded to the component; they are copied into the buffer.
+    /// \param entity Pending entity to add the component to.
+    /// \param args Arguments to be forwarded to the component.
+    template <typename Comp, typename... Args> void addComponent(PendingEntity entity, Args&&... args);
+    /// Records the removal of a component from an entity. If the entity has been removed meanwhile, this does nothing.
+    /// \tparam Comp Type of the component to be removed.
+    /// \param handle Handle of the entity to remove the component from.
+    template <typename Comp> void removeComponent(const EntityHandle& handle);
+    /// Records the change of an entity's enabled state. If the entity has been removed meanwhile, this does nothing.
+    /// \param handle Handle of the entity to be enabled or disabled.
+    /// \param enabled True if the entity should be enabled, false if it should be disabled.
+    void enableEntity(const EntityHandle& handle, bool enabled = true);
+    /// Records the disabling of an entity. If the entity has been removed meanwhile, this does nothing.
+    /// \param handle Handle of the entity to be disabled.
+    void disableEntity(const EntityHandle& handle) { enableEntity(handle, false); }
+    /// Records the removal of an entity from the world. If the entity has already been removed, this does nothing.
+    /// \param handle Handle of the entity to be removed.
+    void removeEntity(const EntityHandle& handle);
+    /// Discards all the recorded commands.
+    void clear() noexcept;
+
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(CommandBuffer&&) noexcept = default;
+
+  private:
+    using Command = std::function<void(World&, std::vector<Entity*>&)>;
+
+    /// Applies the recorded commands to the given world in the order they have been recorded, then clears the buffer.
+    /// \param world World to apply the commands to.
+    void execute(World& world);
+
+    std::vector<Command> m_commands {};
+    std::size_t m_pendingEntityCount = 0;
+  };
+
   World() = default;
-  explicit World(std::size_t entityCount) { m_entities.reserve(entityCount); }
+  /// Creates a world.
+  /// \param entityCount Amount of entities to reserve.
+  /// \param componentStorageType Way the components of the world's entities are stored. Dense storage keeps all components of
+  ///   the same type contiguous, at the cost of invalidating references to a component when another one of its type is removed.
+  explicit World(std::size_t entityCount, ComponentStorageType componentStorageType = ComponentStorageType::PER_ENTITY);
   World(const World&) = delete;
-  World(World&&) noexcept = default;
+  World(World&& world) noexcept;
 
   const std::vector<SystemPtr>& getSystems() const { return m_systems; }
   const std::vector<EntityPtr>& getEntities() const { return m_entities; }
+  /// Gets the graph of dependencies between the active systems, which also gives their last execution times & critical path.
+  /// \return Graph of the systems.
+  const SystemGraph& getSystemGraph() const noexcept { return m_systemGraph; }
+  /// Gets the dense storage holding the entities' components.
+  /// \return Pointer to the component storage, or nullptr if the entities own their components themselves.
+  const ComponentStorage* getComponentStorage() const noexcept { return m_componentStorage.get(); }
+  float getFixedTimeStep() const noexcept { return m_fixedTimeStep; }
+  std::size_t getMaxStepCount() const noexcept { return m_maxStepCount; }
+  /// Gets the number of fixed steps the systems have executed during the last update.
+  /// \return Number of fixed steps executed.
+  std::size_t getStepCount() const noexcept { return m_stepCount; }
+  /// Gets the fraction of a fixed step which has elapsed since the last one, in [0; 1). Rendering can use it to blend the
+  ///   state of the last two steps, so that the motion stays smooth whatever the frame rate.
+  /// \return Interpolation factor between the previous & the last fixed steps.
+  float getInterpolationAlpha() const noexcept { return m_remainingTime / m_fixedTimeStep; }
+
+  /// Sets the time step with which the systems are stepped. It is 1/60 seconds by default.
+  /// \param timeStep Fixed time step, in seconds; must be strictly positive.
+  void setFixedTimeStep(float timeStep);
+  /// Sets the maximum number of fixed steps the systems can execute during a single update. It is 8 by default.
+  /// If an update would require more steps, the exceeding time is dropped; this avoids a slow update leading to even more steps
+  ///   on the next one, which would never catch up.
+  /// \param maxStepCount Maximum number of fixed steps per update; must be strictly positive.
+  void setMaxStepCount(std::size_t maxStepCount);
 
   /// Tells if a given system exists within the world.
   /// \tparam Sys Type of the system to be checked.
@@ -57,31 +160,104 @@ public:
   /// \param enabled True if the entity should be active immediately, false otherwise.
   /// \return Reference to the newly added entity.
   template <typename... Comps> Entity& addEntityWithComponents(bool enabled = true);
+  /// Checks if the entity referred to by the given handle still exists within the world.
+  /// \param handle Handle of the entity to be checked.
+  /// \return True if the entity exists, false if it has been removed or if the handle is invalid.
+  bool isAlive(const EntityHandle& handle) const noexcept;
+  /// Gets the entity referred to by the given handle.
+  /// \param handle Handle of the entity to be fetched.
+  /// \return Pointer to the entity, or nullptr if it has been removed or if the handle is invalid.
+  Entity* getEntity(const EntityHandle& handle) const noexcept;
+  /// Removes the given entity from the world, unlinking it from the systems & releasing its components.
+  /// The entity's index is recycled for the next entities to be added; the handles referring to the removed entity become stale.
+  /// \note This function must not be called while the systems are being updated concurrently.
+  /// \param entity Entity to be removed. It must be owned by the world, & must not be used afterward.
+  void removeEntity(const Entity& entity);
+  /// Removes the entity referred to by the given handle from the world. If the handle is stale, this does nothing.
+  /// \note This function must not be called while the systems are being updated concurrently.
+  /// \param handle Handle of the entity to be removed.
+  /// \return True if the entity has been removed, false if it did not exist.
+  bool removeEntity(const EntityHandle& handle);
+  /// Gets a view over all the enabled entities holding at least the given components.
+  /// The matching entities are cached on the first call for a given set of components, then kept up to date as entities change.
+  /// \note This function can be called from systems updated concurrently.
+  /// \tparam Comps Types of the components the entities must hold.
+  /// \return View giving access to the matching entities' components.
+  template <typename... Comps> EntityView<Comps...> view();
+  /// Gets the command buffer of the calling thread, created on the first call from any given thread.
+  /// Recording commands is lock-free; only the first call from a thread locks in order to register its buffer.
+  /// \note This function can be called from systems updated concurrently.
+  /// \return Reference to the current thread's command buffer.
+  CommandBuffer& getCommandBuffer();
+  /// Applies the commands recorded into all command buffers, in the order the buffers have been created; each buffer's commands
+  ///   are applied in the order they have been recorded. This is automatically done at the beginning of each update.
+  /// \note This function must not be called while the systems are being updated concurrently.
+  void executeCommandBuffers();
   /// Updates the world, updating all the systems it contains.
+  /// The commands recorded into the command buffers are applied first, before the entities are refreshed.
+  /// The elapsed time is accumulated, & the systems are then stepped as many times as the fixed time step fits in it.
+  /// Systems which don't access the same components are updated concurrently; the others are updated in the order of their IDs.
   /// \param deltaTime Time elapsed since the last update.
   /// \return True if the world still has active systems, false otherwise.
   bool update(float deltaTime);
   /// Refreshes the world, optimizing the entities & linking/unlinking entities to systems if needed.
+  /// Only the entities which have changed since the last refresh are processed; if none has, this does nothing.
   void refresh();
   /// Destroys the world, releasing all its entities & systems.
   void destroy();
 
   World& operator=(const World&) = delete;
-  World& operator=(World&&) noexcept = default;
+  World& operator=(World&& world) noexcept;
 
   ~World() { destroy(); }
 
 private:
   /// Sorts entities so that the disabled ones are packed to the end of the list.
   void sortEntities();
+  /// Updates the cached entity queries according to the given entity's current state, & marks it to be relinked on the next refresh.
+  /// \param entity Entity which has changed.
+  /// \param enabledStateChanged True if the entity has been enabled or disabled, false if its components have changed.
+  void markDirty(Entity& entity, bool enabledStateChanged);
+  /// Links the entity to the system or unlinks it from the latter, according to the entity's current state.
+  /// \param system System to link the entity to or unlink it from.
+  /// \param entity Entity to be linked or unlinked.
+  static void updateLink(System& system, const EntityPtr& entity);
+  /// Swaps the entities placed at the given positions in the list.
+  /// \param firstPosition Position of the first entity to be swapped.
+  /// \param secondPosition Position of the second entity to be swapped.
+  void swapEntities(std::size_t firstPosition, std::size_t secondPosition) noexcept;
+  /// Generates an identifier unique to each world, used to find the command buffers each thread has recorded into.
+  /// \return New world identifier.
+  static std::size_t generateId() noexcept;
+  /// Makes the entities & systems point to the current world, which may have been moved.
+  void updateOwnership() noexcept;
+
+  static constexpr std::size_t InvalidPosition = std::numeric_limits<std::size_t>::max();
 
   std::vector<SystemPtr> m_systems {};
   Bitset m_activeSystems {};
+  SystemGraph m_systemGraph {};
+  bool m_isSystemGraphDirty = true;
 
   std::vector<EntityPtr> m_entities {};
   std::size_t m_activeEntityCount = 0;
   std::size_t m_maxEntityIndex = 0;
+  std::vector<std::size_t> m_entityPositions {}; ///< Position of each entity in the list, indexed by the entity's ID; InvalidPosition if removed.
+  std::vector<uint32_t> m_entityGenerations {}; ///< Current generation of each entity index.
+  std::vector<std::size_t> m_freeEntityIndices {}; ///< Indices of the removed entities, to be given to the next added ones.
+  std::vector<std::size_t> m_dirtyEntities {}; ///< IDs of the entities which have changed since the last refresh.
+  bool m_isSortingNeeded = false;
+  std::unique_ptr<ComponentStorage> m_componentStorage {}; ///< Must be declared after the entities, which may need it to be released.
+  std::vector<std::unique_ptr<EntityQuery>> m_queries {};
+  std::mutex m_queriesMutex {};
+
+  std::size_t m_id = generateId();
+  std::vector<std::unique_ptr<CommandBuffer>> m_commandBuffers {}; ///< Buffers of all the threads having recorded commands.
+  std::mutex m_commandBuffersMutex {};
 
+  float m_fixedTimeStep = 1.f / 60.f;
+  std::size_t m_maxStepCount = 8;
+  std::size_t m_stepCount = 0;
   float m_remainingTime {}; ///< Extra time remaining after executing the systems' fixed step update.
 };
 
@@ -1,7 +1,49 @@
 #include <algorithm>
+#include <cassert>
+#include <tuple>
 
 namespace Raz {
 
+template <typename Comp, typename... Args>
+void World::CommandBuffer::addComponent(const EntityHandle& handle, Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
+
+  m_commands.emplace_back([handle, arguments = std::make_tuple(std::forward<Args>(args)...)] (World& world, std::vector<Entity*>&) mutable {
+    Entity* entity = world.getEntity(handle);
+
+    if (entity == nullptr)
+      return;
+
+    std::apply([entity] (auto&&... componentArgs) {
+      entity->addComponent<Comp>(std::forward<decltype(componentArgs)>(componentArgs)...);
+    }, std::move(arguments));
+  });
+}
+
+template <typename Comp, typename... Args>
+void World::CommandBuffer::addComponent(PendingEntity entity, Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
+  assert("Error: The pending entity must have been recorded into this command buffer." && entity.index < m_pendingEntityCount);
+
+  m_commands.emplace_back([entity, arguments = std::make_tuple(std::forward<Args>(args)...)] (World&, std::vector<Entity*>& createdEntities) mutable {
+    std::apply([&createdEntities, entity] (auto&&... componentArgs) {
+      createdEntities[entity.index]->addComponent<Comp>(std::forward<decltype(componentArgs)>(componentArgs)...);
+    }, std::move(arguments));
+  });
+}
+
+template <typename Comp>
+void World::CommandBuffer::removeComponent(const EntityHandle& handle) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Removed component must be derived from Component.");
+
+  m_commands.emplace_back([handle] (World& world, std::vector<Entity*>&) {
+    Entity* entity = world.getEntity(handle);
+
+    if (entity != nullptr)
+      entity->removeComponent<Comp>();
+  });
+}
+
 template <typename Sys>
 bool World::hasSystem() const {
   static_assert(std::is_base_of_v<System, Sys>, "Error: Checked system must be derived from System.");
@@ -30,7 +72,12 @@ Sys& World::addSystem(Args&&... args) {
     m_systems.resize(sysId + 1);
 
   m_systems[sysId] = std::make_unique<Sys>(std::forward<Args>(args)...);
+  m_systems[sysId]->m_world = this;
   m_activeSystems.setBit(sysId);
+  m_isSystemGraphDirty = true;
+
+  for (const EntityPtr& entity : m_entities)
+    updateLink(*m_systems[sysId], entity);
 
   return static_cast<Sys&>(*m_systems[sysId]);
 }
@@ -39,8 +86,14 @@ template <typename Sys>
 void World::removeSystem() {
   static_assert(std::is_base_of_v<System, Sys>, "Error: Removed system must be derived from System.");
 
-  if (hasSystem<Sys>())
-    m_systems[System::getId<Sys>()].reset();
+  if (!hasSystem<Sys>())
+    return;
+
+  const std::size_t sysId = System::getId<Sys>();
+
+  m_systems[sysId].reset();
+  m_activeSystems.setBit(sysId, false);
+  m_isSystemGraphDirty = true;
 }
 
 template <typename Comp, typename... Args>
@@ -59,4 +112,25 @@ Entity& World::addEntityWithComponents(bool enabled) {
   return entity;
 }
 
+template <typename... Comps>
+EntityView<Comps...> World::view() {
+  Bitset components;
+  (components.setBit(Component::getId<Comps>()), ...);
+
+  // Views may be requested by systems updated concurrently
+  std::lock_guard<std::mutex> lock(m_queriesMutex);
+
+  for (const std::unique_ptr<EntityQuery>& query : m_queries) {
+    if (query->getComponents().getSize() == components.getSize() && query->getComponents() == components)
+      return EntityView<Comps...>(*query);
+  }
+
+  EntityQuery& query = *m_queries.emplace_back(std::make_unique<EntityQuery>(std::move(components)));
+
+  for (const EntityPtr& entity : m_entities)
+    query.update(*entity);
+
+  return EntityView<Comps...>(query);
+}
+
 } // namespace Raz
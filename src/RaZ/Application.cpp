@@ -1,9 +1,15 @@
 #include "RaZ/Application.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
 
 #if defined(RAZ_PLATFORM_EMSCRIPTEN)
 #include <emscripten.h>
 #endif
 
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
 namespace Raz {
 
 void Application::run() {
@@ -16,20 +22,125 @@ void Application::run() {
 #endif
 }
 
+void Application::pinWorldToMainThread(std::size_t worldIndex, bool pinned) {
+  assert("Error: The world to be pinned must exist." && worldIndex < m_worlds.size());
+  m_pinnedWorlds.setBit(worldIndex, pinned);
+}
+
+void Application::setFixedTimeStep(float timeStep) {
+  assert("Error: The fixed time step must not be negative." && timeStep >= 0.f);
+  m_fixedTimeStep = timeStep;
+}
+
+void Application::setTargetTickRate(float tickRate) {
+  assert("Error: The target tick rate must not be negative." && tickRate >= 0.f);
+
+  m_targetTickRate = tickRate;
+  m_tickPeriod     = (tickRate > 0.f ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(1.f / tickRate))
+                                     : Clock::duration::zero());
+  m_nextTickTime   = Clock::now();
+}
+
 bool Application::runOnce() {
-  const auto currentTime = std::chrono::system_clock::now();
-  m_deltaTime            = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
-  m_lastFrameTime        = currentTime;
+  // The previous frame is ended before profiling the current one, so that the latter is entirely part of the next frame
+  RAZ_PROFILE_FRAME();
+
+  waitForNextTick();
+
+  RAZ_PROFILE_ZONE("Application::runOnce");
+
+  const Clock::time_point currentTime = Clock::now();
+  m_deltaTime     = (m_fixedTimeStep > 0.f ? m_fixedTimeStep : std::chrono::duration<float>(currentTime - m_lastFrameTime).count());
+  m_lastFrameTime = currentTime;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_isUpdatingWorldsInParallel)
+    updateWorldsConcurrently();
+  else
+    updateWorlds(currentTime);
+#else
+  updateWorlds(currentTime);
+#endif
+
+  const double tickTime = std::chrono::duration<double, std::milli>(Clock::now() - currentTime).count();
+
+  m_tickStats.minTime     = (m_tickStats.tickCount == 0 ? tickTime : std::min(m_tickStats.minTime, tickTime));
+  m_tickStats.maxTime     = std::max(m_tickStats.maxTime, tickTime);
+  m_tickStats.averageTime = (m_tickStats.averageTime * static_cast<double>(m_tickStats.tickCount) + tickTime)
+                          / static_cast<double>(m_tickStats.tickCount + 1);
+  m_tickStats.lastTime    = tickTime;
+  ++m_tickStats.tickCount;
+
+  return m_isRunning && !m_activeWorlds.isEmpty();
+}
+
+void Application::waitForNextTick() {
+#if !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  if (m_tickPeriod == Clock::duration::zero())
+    return;
+
+  // Sleeping is only precise up to the scheduler's granularity; the thread thus sleeps until shortly before the deadline, then yields
+  constexpr std::chrono::milliseconds spinDuration(2);
 
+  if (m_nextTickTime - Clock::now() > spinDuration)
+    std::this_thread::sleep_until(m_nextTickTime - spinDuration);
+
+  while (Clock::now() < m_nextTickTime)
+    std::this_thread::yield();
+
+  // The next deadline is computed from the current one so that the rate does not drift, unless too late to catch up
+  const Clock::time_point currentTime = Clock::now();
+  m_nextTickTime = (currentTime - m_nextTickTime > m_tickPeriod ? currentTime : m_nextTickTime) + m_tickPeriod;
+#endif
+}
+
+void Application::updateWorlds(Clock::time_point currentTime) {
   for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
     if (!m_activeWorlds[worldIndex])
       continue;
 
+    m_worldUpdateTimes[worldIndex] = currentTime;
+
     if (!m_worlds[worldIndex].update(m_deltaTime))
       m_activeWorlds.setBit(worldIndex, false);
   }
+}
 
-  return m_isRunning && !m_activeWorlds.isEmpty();
+#if defined(RAZ_THREADS_AVAILABLE)
+void Application::updateWorldsConcurrently() {
+  m_worldUpdateResults.assign(m_worlds.size(), true);
+
+  const auto updateWorld = [this] (std::size_t worldIndex) {
+    const Clock::time_point updateTime = Clock::now();
+    const float deltaTime = (m_fixedTimeStep > 0.f ? m_fixedTimeStep
+                                                   : std::chrono::duration<float>(updateTime - m_worldUpdateTimes[worldIndex]).count());
+    m_worldUpdateTimes[worldIndex] = updateTime;
+
+    m_worldUpdateResults[worldIndex] = m_worlds[worldIndex].update(deltaTime);
+  };
+
+  {
+    Threading::TaskGroup taskGroup;
+
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (m_activeWorlds[worldIndex] && !isWorldPinnedToMainThread(worldIndex))
+        taskGroup.run([&updateWorld, worldIndex] () { updateWorld(worldIndex); });
+    }
+
+    // The pinned worlds are updated on the current thread while the others are being updated by the workers
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (m_activeWorlds[worldIndex] && isWorldPinnedToMainThread(worldIndex))
+        updateWorld(worldIndex);
+    }
+
+    taskGroup.wait();
+  }
+
+  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+    if (!m_worldUpdateResults[worldIndex])
+      m_activeWorlds.setBit(worldIndex, false);
+  }
 }
+#endif
 
 } // namespace Raz
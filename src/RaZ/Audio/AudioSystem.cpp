@@ -3,6 +3,7 @@
 #include "RaZ/Audio/Sound.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Utils/StrUtils.hpp"
+#include "RaZ/World.hpp"
 
 #include <iostream>
 #include <string_view>
@@ -36,6 +37,10 @@ AudioSystem::AudioSystem(const char* deviceName) {
   m_acceptedComponents.setBit(Component::getId<Sound>());
   m_acceptedComponents.setBit(Component::getId<Listener>());
 
+  m_readComponents.setBit(Component::getId<Transform>());
+  m_writeComponents.setBit(Component::getId<Sound>());
+  m_writeComponents.setBit(Component::getId<Listener>());
+
   openDevice(deviceName);
 }
 
@@ -66,45 +71,27 @@ std::string AudioSystem::recoverCurrentDevice() const {
 }
 
 bool AudioSystem::update(float /* deltaTime */) {
-#if defined(RAZ_CONFIG_DEBUG)
-  // Checking that only one Listener exists
-  bool hasOneListener = false;
-#endif
-
-  for (Entity* entity : m_entities) {
-    if (entity->hasComponent<Sound>()) {
-      const Sound& sound = entity->getComponent<Sound>();
-
-      if (entity->hasComponent<Transform>()) {
-        auto& soundTrans = entity->getComponent<Transform>();
-
-        // TODO: Transform's update status may be reinitialized in the RenderSystem (and should theoretically be reset in every system, including here)
-        //  A viable solution must be implemented to check for and reset this status in all systems
-        //if (soundTrans.hasUpdated()) {
-          sound.setPosition(soundTrans.getPosition());
-          //soundTrans.setUpdated(false);
-        //}
-      }
-    }
-
-    if (entity->hasComponent<Listener>()) {
-#if defined(RAZ_CONFIG_DEBUG)
-      assert("Error: Only one Listener component must exist in an AudioSystem." && !hasOneListener);
-      hasOneListener = true;
-#endif
-
-      assert("Error: A Listener entity must have a Transform component." && entity->hasComponent<Transform>());
-
-      auto& listener      = entity->getComponent<Listener>();
-      auto& listenerTrans = entity->getComponent<Transform>();
-
-      //if (listenerTrans.hasUpdated()) {
-        listener.setPosition(listenerTrans.getPosition());
-        listener.setOrientation(Mat3f(listenerTrans.computeTransformMatrix()));
-
-        //listenerTrans.setUpdated(false);
-      //}
-    }
+  assert("Error: The audio system must belong to a world to be updated." && m_world != nullptr);
+
+  for (auto [sound, soundTrans] : m_world->view<Sound, Transform>()) {
+    // TODO: Transform's update status may be reinitialized in the RenderSystem (and should theoretically be reset in every system, including here)
+    //  A viable solution must be implemented to check for and reset this status in all systems
+    //if (soundTrans.hasUpdated()) {
+      sound.setPosition(soundTrans.getPosition());
+      //soundTrans.setUpdated(false);
+    //}
+  }
+
+  const EntityView<Listener, Transform> listeners = m_world->view<Listener, Transform>();
+  assert("Error: Only one Listener component must exist in an AudioSystem." && listeners.getSize() <= 1);
+
+  for (auto [listener, listenerTrans] : listeners) {
+    //if (listenerTrans.hasUpdated()) {
+      listener.setPosition(listenerTrans.getPosition());
+      listener.setOrientation(Mat3f(listenerTrans.computeTransformMatrix()));
+
+      //listenerTrans.setUpdated(false);
+    //}
   }
 
   return true;
@@ -0,0 +1,10 @@
+#include "RaZ/ComponentStorage.hpp"
+
+namespace Raz {
+
+void ComponentStorage::removeComponent(std::size_t componentId, std::size_t entityIndex) {
+  if (componentId < m_pools.size() && m_pools[componentId])
+    m_pools[componentId]->remove(entityIndex);
+}
+
+} // namespace Raz
@@ -0,0 +1,30 @@
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+
+namespace Raz {
+
+void Entity::enable(bool enabled) {
+  if (enabled == m_enabled)
+    return;
+
+  m_enabled = enabled;
+  notifyWorld(true);
+}
+
+Entity::~Entity() {
+  if (m_componentStorage == nullptr)
+    return;
+
+  // The components placed in a dense storage are not owned by the entity; they must be released manually
+  for (std::size_t compId = 0; compId < m_enabledComponents.getSize(); ++compId) {
+    if (m_enabledComponents[compId])
+      m_componentStorage->removeComponent(compId, m_id);
+  }
+}
+
+void Entity::notifyWorld(bool enabledStateChanged) {
+  if (m_world)
+    m_world->markDirty(*this, enabledStateChanged);
+}
+
+} // namespace Raz
@@ -0,0 +1,46 @@
+#include "RaZ/EntityQuery.hpp"
+
+namespace Raz {
+
+bool EntityQuery::matches(const Entity& entity) const {
+  return (entity.isEnabled() && entity.getEnabledComponents().includes(m_components));
+}
+
+void EntityQuery::update(Entity& entity) {
+  const bool isMatching = matches(entity);
+
+  if (isMatching == contains(entity))
+    return;
+
+  if (!isMatching) {
+    remove(entity);
+    return;
+  }
+
+  if (entity.getId() >= m_entityPositions.size())
+    m_entityPositions.resize(entity.getId() + 1, InvalidPosition);
+
+  m_entityPositions[entity.getId()] = m_entities.size();
+  m_entities.emplace_back(&entity);
+}
+
+void EntityQuery::remove(const Entity& entity) {
+  if (!contains(entity))
+    return;
+
+  // Swapping the entity with the last one, so that the removal is made in constant time
+  const std::size_t entityPos = m_entityPositions[entity.getId()];
+  Entity* lastEntity          = m_entities.back();
+
+  m_entities[entityPos]                  = lastEntity;
+  m_entityPositions[lastEntity->getId()] = entityPos;
+  m_entityPositions[entity.getId()]      = InvalidPosition;
+  m_entities.pop_back();
+}
+
+void EntityQuery::clear() noexcept {
+  m_entities.clear();
+  m_entityPositions.clear();
+}
+
+} // namespace Raz
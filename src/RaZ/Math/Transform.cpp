@@ -4,17 +4,17 @@ namespace Raz {
 
 void Transform::setPosition(const Vec3f& position) {
   m_position = position;
-  m_updated  = true;
+  updateLocalMatrix();
 }
 
 void Transform::setRotation(const Quaternionf& rotation) {
   m_rotation = rotation;
-  m_updated  = true;
+  updateLocalMatrix();
 }
 
 void Transform::setScale(const Vec3f& scale) {
   m_scale   = scale;
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 void Transform::translate(float x, float y, float z) {
@@ -22,7 +22,7 @@ void Transform::translate(float x, float y, float z) {
   m_position[1] += y;
   m_position[2] += z;
 
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 void Transform::rotate(Radiansf angle, const Vec3f& axis) {
@@ -31,7 +31,7 @@ void Transform::rotate(Radiansf angle, const Vec3f& axis) {
   const Quaternionf quaternion(angle, axis);
   m_rotation = quaternion * m_rotation;
 
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 void Transform::rotate(Radiansf xAngle, Radiansf yAngle) {
@@ -39,7 +39,7 @@ void Transform::rotate(Radiansf xAngle, Radiansf yAngle) {
   const Quaternionf yQuat(yAngle, Axis::Y);
   m_rotation = xQuat * m_rotation * yQuat;
 
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 void Transform::rotate(Radiansf xAngle, Radiansf yAngle, Radiansf zAngle) {
@@ -48,7 +48,7 @@ void Transform::rotate(Radiansf xAngle, Radiansf yAngle, Radiansf zAngle) {
   const Quaternionf zQuat(zAngle, Axis::Z);
   m_rotation = xQuat * yQuat * zQuat * m_rotation;
 
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 void Transform::scale(float x, float y, float z) {
@@ -56,7 +56,7 @@ void Transform::scale(float x, float y, float z) {
   m_scale[1] *= y;
   m_scale[2] *= z;
 
-  m_updated = true;
+  updateLocalMatrix();
 }
 
 Mat4f Transform::computeTranslationMatrix(bool reverseTranslation) const {
@@ -78,4 +78,10 @@ Mat4f Transform::computeTransformMatrix() const {
   return scale * m_rotation.computeMatrix() * computeTranslationMatrix();
 }
 
+void Transform::updateLocalMatrix() {
+  m_localMatrix        = computeTransformMatrix();
+  m_updated            = true;
+  m_isWorldMatrixDirty = true;
+}
+
 } // namespace Raz
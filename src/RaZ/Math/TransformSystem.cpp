@@ -0,0 +1,206 @@
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Math/TransformSystem.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Raz {
+
+TransformSystem::TransformSystem() {
+  m_writeComponents.setBit(Component::getId<Transform>());
+}
+
+Entity* TransformSystem::getParent(const Entity& child) const {
+  if (child.getId() >= m_links.size() || m_links[child.getId()].entity != child.getHandle())
+    return nullptr;
+
+  return m_world->getEntity(m_links[child.getId()].parent);
+}
+
+const std::vector<EntityHandle>& TransformSystem::getChildren(const Entity& parent) const {
+  static const std::vector<EntityHandle> noChildren {};
+
+  if (parent.getId() >= m_links.size() || m_links[parent.getId()].entity != parent.getHandle())
+    return noChildren;
+
+  return m_links[parent.getId()].children;
+}
+
+void TransformSystem::setParent(Entity& child, const Entity& parent) {
+  assert("Error: The transform system must belong to a world to set a parent." && m_world != nullptr);
+  assert("Error: The child & parent entities must have a Transform component."
+      && child.hasComponent<Transform>() && parent.hasComponent<Transform>());
+
+#if !defined(NDEBUG)
+  for (const Entity* ancestor = &parent; ancestor != nullptr; ancestor = getParent(*ancestor))
+    assert("Error: An entity can't be attached to itself or to one of its descendants." && ancestor != &child);
+#endif
+
+  if (getParent(child) != nullptr)
+    removeParent(child);
+
+  // The parent's link is fetched first, since fetching the child's may reallocate the links
+  fetchLink(parent).children.emplace_back(child.getHandle());
+  fetchLink(child).parent = parent.getHandle();
+
+  // The world matrix is computed right away, so that it is valid even before the next update
+  auto& transform = child.getComponent<Transform>();
+  transform.m_worldMatrix        = transform.m_localMatrix * parent.getComponent<Transform>().getWorldMatrix();
+  transform.m_hasParent          = true;
+  transform.m_isWorldMatrixDirty = true;
+
+  m_isHierarchyDirty = true;
+}
+
+void TransformSystem::removeParent(Entity& child) {
+  if (child.getId() >= m_links.size() || m_links[child.getId()].entity != child.getHandle())
+    return;
+
+  HierarchyLink& childLink = m_links[child.getId()];
+
+  if (childLink.parent == EntityHandle())
+    return;
+
+  if (childLink.parent.index < m_links.size() && m_links[childLink.parent.index].entity == childLink.parent) {
+    std::vector<EntityHandle>& siblings = m_links[childLink.parent.index].children;
+    siblings.erase(std::find(siblings.begin(), siblings.end(), child.getHandle()));
+  }
+
+  childLink.parent = EntityHandle();
+
+  if (child.hasComponent<Transform>()) {
+    auto& transform = child.getComponent<Transform>();
+    transform.m_hasParent          = false;
+    transform.m_isWorldMatrixDirty = true; // Its children must be recomputed
+  }
+
+  m_isHierarchyDirty = true;
+}
+
+bool TransformSystem::update(float) {
+  if (m_isHierarchyDirty)
+    rebuildHierarchy();
+
+  // Since the nodes are sorted breadth-first, a node's parent has always been processed before it
+  for (std::size_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex) {
+    Transform* transform          = findTransform(m_nodes[nodeIndex]);
+    m_nodeTransforms[nodeIndex]   = transform;
+    const std::size_t parentIndex = m_nodeParents[nodeIndex];
+
+    if (transform == nullptr) {
+      // The node has been removed; it will be unlinked from its children once the update is done
+      m_changedNodes[nodeIndex] = true;
+      m_isHierarchyDirty        = true;
+      continue;
+    }
+
+    const bool hasParentChanged = (parentIndex != InvalidIndex && m_changedNodes[parentIndex]);
+    m_changedNodes[nodeIndex]   = (transform->m_isWorldMatrixDirty || hasParentChanged);
+
+    if (!m_changedNodes[nodeIndex])
+      continue;
+
+    transform->m_isWorldMatrixDirty = false;
+
+    if (parentIndex == InvalidIndex)
+      continue;
+
+    const Transform* parentTransform = m_nodeTransforms[parentIndex];
+
+    if (parentTransform == nullptr) {
+      transform->m_hasParent = false;
+      continue;
+    }
+
+    transform->m_worldMatrix = transform->m_localMatrix * parentTransform->getWorldMatrix();
+  }
+
+  if (m_isHierarchyDirty)
+    rebuildHierarchy();
+
+  return true;
+}
+
+TransformSystem::HierarchyLink& TransformSystem::fetchLink(const Entity& entity) {
+  if (entity.getId() >= m_links.size())
+    m_links.resize(entity.getId() + 1);
+
+  HierarchyLink& link = m_links[entity.getId()];
+
+  // The link may refer to a removed entity whose index has been recycled
+  if (link.entity != entity.getHandle())
+    link = HierarchyLink{ entity.getHandle(), {}, {} };
+
+  return link;
+}
+
+Transform* TransformSystem::findTransform(const EntityHandle& handle) const {
+  Entity* entity = m_world->getEntity(handle);
+
+  if (entity == nullptr || !entity->hasComponent<Transform>())
+    return nullptr;
+
+  return &entity->getComponent<Transform>();
+}
+
+void TransformSystem::rebuildHierarchy() {
+  for (HierarchyLink& link : m_links) {
+    if (link.entity != EntityHandle() && findTransform(link.entity) == nullptr)
+      link = HierarchyLink();
+  }
+
+  const auto isLinked = [this] (const EntityHandle& handle) {
+    return (handle.index < m_links.size() && m_links[handle.index].entity == handle);
+  };
+
+  for (HierarchyLink& link : m_links) {
+    if (link.entity == EntityHandle())
+      continue;
+
+    // The children of a removed parent become roots
+    if (link.parent != EntityHandle() && !isLinked(link.parent)) {
+      link.parent = EntityHandle();
+
+      Transform& transform           = *findTransform(link.entity);
+      transform.m_hasParent          = false;
+      transform.m_isWorldMatrixDirty = true;
+    }
+
+    link.children.erase(std::remove_if(link.children.begin(), link.children.end(), [&isLinked] (const EntityHandle& child) {
+      return !isLinked(child);
+    }), link.children.end());
+  }
+
+  m_nodes.clear();
+  m_nodeParents.clear();
+
+  for (HierarchyLink& link : m_links) {
+    if (link.entity == EntityHandle() || link.parent != EntityHandle())
+      continue;
+
+    // An entity with neither a parent nor children is not part of the hierarchy anymore
+    if (link.children.empty()) {
+      link = HierarchyLink();
+      continue;
+    }
+
+    m_nodes.emplace_back(link.entity);
+    m_nodeParents.emplace_back(InvalidIndex);
+  }
+
+  // The list itself is used as the traversal queue, each node's children being appended after it
+  for (std::size_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex) {
+    for (const EntityHandle& child : m_links[m_nodes[nodeIndex].index].children) {
+      m_nodes.emplace_back(child);
+      m_nodeParents.emplace_back(nodeIndex);
+    }
+  }
+
+  m_nodeTransforms.resize(m_nodes.size());
+  m_changedNodes.resize(m_nodes.size());
+
+  m_isHierarchyDirty = false;
+}
+
+} // namespace Raz
@@ -1,105 +1,140 @@
 #include "RaZ/Physics/Collider.hpp"
 
-namespace Raz {
-
-void Collider::setShape(Shape&& shape) {
-  m_shapeType = shape.getType();
-
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      m_colliderShape = std::make_unique<Line>(static_cast<Line&&>(shape));
-      break;
+#include <array>
 
-    case ShapeType::PLANE:
-      m_colliderShape = std::make_unique<Plane>(static_cast<Plane&&>(shape));
-      break;
+namespace Raz {
 
-    case ShapeType::SPHERE:
-      m_colliderShape = std::make_unique<Sphere>(static_cast<Sphere&&>(shape));
-      break;
+namespace {
+
+constexpr std::size_t ShapeTypeCount = std::variant_size_v<Collider::ShapeVariant>;
+
+template <ShapeType Type, typename ShapeT>
+constexpr bool isShapeIndexValid = std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(Type), Collider::ShapeVariant>, ShapeT>;
+
+// The shape's type is deduced from the variant's index, which must thus match the ShapeType enumeration
+static_assert(isShapeIndexValid<ShapeType::LINE, Line> && isShapeIndexValid<ShapeType::PLANE, Plane>
+           && isShapeIndexValid<ShapeType::SPHERE, Sphere> && isShapeIndexValid<ShapeType::TRIANGLE, Triangle>
+           && isShapeIndexValid<ShapeType::QUAD, Quad> && isShapeIndexValid<ShapeType::AABB, AABB>
+           && isShapeIndexValid<ShapeType::OBB, OBB>, "Error: The collider's shapes must be in the same order as the ShapeType enumeration.");
+
+using ShapeIntersectionFunc = bool (*)(const Collider::ShapeVariant&, const Collider::ShapeVariant&);
+using RayIntersectionFunc   = bool (*)(const Collider::ShapeVariant&, const Ray&, RayHit*);
+
+/// Calls the given function on the concrete shape held by the variant.
+/// \note This is preferred over std::visit, which is not always compiled as a simple jump table.
+/// \tparam FuncT Type of the function to be called.
+/// \param shape Variant holding the shape.
+/// \param func Function to be called, taking the concrete shape as parameter.
+/// \return Result of the function.
+template <typename FuncT>
+decltype(auto) visitShape(const Collider::ShapeVariant& shape, FuncT&& func) {
+  switch (static_cast<ShapeType>(shape.index())) {
+    case ShapeType::LINE:     return func(*std::get_if<Line>(&shape));
+    case ShapeType::PLANE:    return func(*std::get_if<Plane>(&shape));
+    case ShapeType::SPHERE:   return func(*std::get_if<Sphere>(&shape));
+    case ShapeType::TRIANGLE: return func(*std::get_if<Triangle>(&shape));
+    case ShapeType::QUAD:     return func(*std::get_if<Quad>(&shape));
+    case ShapeType::AABB:     return func(*std::get_if<AABB>(&shape));
+    case ShapeType::OBB:      return func(*std::get_if<OBB>(&shape));
+    default: break;
+  }
 
-    case ShapeType::TRIANGLE:
-      m_colliderShape = std::make_unique<Triangle>(static_cast<Triangle&&>(shape));
-      break;
+  throw std::invalid_argument("Error: Unhandled shape type in the collider");
+}
 
-    case ShapeType::QUAD:
-      m_colliderShape = std::make_unique<Quad>(static_cast<Quad&&>(shape));
-      break;
+template <std::size_t FirstIndex, std::size_t SecondIndex>
+bool intersectShapes(const Collider::ShapeVariant& firstShape, const Collider::ShapeVariant& secondShape) {
+  // Both shapes' concrete types being known & final, the called function is resolved statically
+  return std::get_if<FirstIndex>(&firstShape)->intersects(*std::get_if<SecondIndex>(&secondShape));
+}
 
-    case ShapeType::AABB:
-      m_colliderShape = std::make_unique<AABB>(static_cast<AABB&&>(shape));
-      break;
+template <std::size_t FirstIndex, std::size_t... SecondIndices>
+constexpr std::array<ShapeIntersectionFunc, ShapeTypeCount> makeShapeIntersectionRow(std::index_sequence<SecondIndices...>) {
+  return { &intersectShapes<FirstIndex, SecondIndices>... };
+}
 
-    case ShapeType::OBB:
-      m_colliderShape = std::make_unique<OBB>(static_cast<OBB&&>(shape));
-      break;
+template <std::size_t... FirstIndices>
+constexpr std::array<std::array<ShapeIntersectionFunc, ShapeTypeCount>, ShapeTypeCount> makeShapeIntersectionTable(std::index_sequence<FirstIndices...>) {
+  return { makeShapeIntersectionRow<FirstIndices>(std::make_index_sequence<ShapeTypeCount>())... };
+}
 
-    default:
-      throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
+template <std::size_t Index>
+bool intersectRay(const Collider::ShapeVariant& shape, const Ray& ray, RayHit* hit) {
+  using ShapeT = std::variant_alternative_t<Index, Collider::ShapeVariant>;
+
+  // TODO: the ray/line, ray/quad & ray/OBB intersections are not implemented yet
+  if constexpr (std::is_same_v<ShapeT, Line> || std::is_same_v<ShapeT, Quad> || std::is_same_v<ShapeT, OBB>) {
+    static_cast<void>(shape);
+    static_cast<void>(ray);
+    static_cast<void>(hit);
+    throw std::invalid_argument("Error: Unhandled shape type in the collider/ray intersection check");
+  } else {
+    return ray.intersects(*std::get_if<Index>(&shape), hit);
   }
 }
 
-bool Collider::intersects(const Shape& shape) const {
-  switch (m_shapeType) {
-    case ShapeType::LINE:
-      return shape.intersects(static_cast<const Line&>(*m_colliderShape));
-
-    case ShapeType::PLANE:
-      return shape.intersects(static_cast<const Plane&>(*m_colliderShape));
+template <std::size_t... Indices>
+constexpr std::array<RayIntersectionFunc, ShapeTypeCount> makeRayIntersectionTable(std::index_sequence<Indices...>) {
+  return { &intersectRay<Indices>... };
+}
 
-    case ShapeType::SPHERE:
-      return shape.intersects(static_cast<const Sphere&>(*m_colliderShape));
+/// Intersection functions between two collider shapes, indexed by the first & second shapes' types.
+constexpr std::array<std::array<ShapeIntersectionFunc, ShapeTypeCount>, ShapeTypeCount> shapeIntersectionTable =
+  makeShapeIntersectionTable(std::make_index_sequence<ShapeTypeCount>());
+/// Intersection functions between a collider shape & a ray, indexed by the shape's type.
+constexpr std::array<RayIntersectionFunc, ShapeTypeCount> rayIntersectionTable = makeRayIntersectionTable(std::make_index_sequence<ShapeTypeCount>());
 
-    case ShapeType::TRIANGLE:
-      return shape.intersects(static_cast<const Triangle&>(*m_colliderShape));
+} // namespace
 
-    case ShapeType::QUAD:
-      return shape.intersects(static_cast<const Quad&>(*m_colliderShape));
+const Shape& Collider::getShape() const noexcept {
+  return visitShape(m_shape, [] (const auto& shape) -> const Shape& { return shape; });
+}
 
-    case ShapeType::AABB:
-      return shape.intersects(static_cast<const AABB&>(*m_colliderShape));
+bool Collider::intersects(const Collider& collider) const {
+  return shapeIntersectionTable[m_shape.index()][collider.m_shape.index()](m_shape, collider.m_shape);
+}
 
-    case ShapeType::OBB:
-      return shape.intersects(static_cast<const OBB&>(*m_colliderShape));
+bool Collider::intersects(const Shape& shape) const {
+  // The given shape's type being unknown, only the collider's shape can be resolved statically
+  return visitShape(m_shape, [&shape] (const auto& colliderShape) { return shape.intersects(colliderShape); });
+}
 
-    default:
-      break;
-  }
+bool Collider::intersects(const Ray& ray, RayHit* hit) const {
+  return rayIntersectionTable[m_shape.index()](m_shape, ray, hit);
+}
 
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/shape intersection check");
+AABB Collider::computeBoundingBox() const {
+  return visitShape(m_shape, [] (const auto& shape) { return shape.computeBoundingBox(); });
 }
 
-bool Collider::intersects(const Ray& ray, RayHit* hit) const {
-  switch (m_shapeType) {
+Collider::ShapeVariant Collider::createShape(Shape&& shape) {
+  switch (shape.getType()) {
     case ShapeType::LINE:
-      //return ray.intersects(static_cast<const Line&>(*m_colliderShape), hit);
-      break;
+      return static_cast<Line&&>(shape);
 
     case ShapeType::PLANE:
-      return ray.intersects(static_cast<const Plane&>(*m_colliderShape), hit);
+      return static_cast<Plane&&>(shape);
 
     case ShapeType::SPHERE:
-      return ray.intersects(static_cast<const Sphere&>(*m_colliderShape), hit);
+      return static_cast<Sphere&&>(shape);
 
     case ShapeType::TRIANGLE:
-      return ray.intersects(static_cast<const Triangle&>(*m_colliderShape), hit);
+      return static_cast<Triangle&&>(shape);
 
     case ShapeType::QUAD:
-      //return ray.intersects(static_cast<const Quad&>(*m_colliderShape), hit);
-      break;
+      return static_cast<Quad&&>(shape);
 
     case ShapeType::AABB:
-      return ray.intersects(static_cast<const AABB&>(*m_colliderShape), hit);
+      return static_cast<AABB&&>(shape);
 
     case ShapeType::OBB:
-      //return ray.intersects(static_cast<const OBB&>(*m_colliderShape), hit);
-      break;
+      return static_cast<OBB&&>(shape);
 
     default:
       break;
   }
 
-  throw std::invalid_argument("Error: Unhandled shape type in the collider/ray intersection check");
+  throw std::invalid_argument("Error: Unhandled shape type in the collider shape setter");
 }
 
 } // namespace Raz
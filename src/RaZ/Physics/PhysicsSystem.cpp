@@ -2,96 +2,938 @@
 #include "RaZ/Physics/Collider.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/ShapeSweep.hpp"
+#include "RaZ/Utils/SimdUtils.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/World.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace Raz {
 
+namespace {
+
+constexpr uint32_t ColliderProxyCategory = 1;
+constexpr uint32_t MovementProxyCategory = 2;
+
+#if defined(RAZ_SIMD_AVX)
+constexpr std::size_t PackSize = 8;
+#else
+constexpr std::size_t PackSize = 4;
+#endif
+
+constexpr float ContactOffset            = 0.002f; ///< Distance along the contact normal at which a colliding body is put back.
+constexpr float ContactMargin            = 0.05f; ///< Distance to a collider under which a body is given a contact with it.
+constexpr float TouchingTolerance        = 0.001f; ///< Distance to a collider under which a body is considered touching it.
+constexpr float WarmStartNormalThreshold = 0.95f; ///< Minimum cosine between a contact's normals of two steps to reuse its impulse.
+
+constexpr uint32_t MaxContactColorCount = 64; ///< Maximum number of contact colors, each body keeping its colors in a 64-bit mask.
+constexpr uint32_t OverflowContactColor = MaxContactColorCount; ///< Color of the contacts involving a body having all the colors.
+
+constexpr std::size_t IntegrationGrainSize = 4096; ///< Minimum number of bodies integrated by each task when done in parallel.
+constexpr std::size_t RaycastGrainSize     = 64; ///< Minimum number of rays cast by each task when done in parallel.
+constexpr std::size_t NarrowphaseGrainSize = 256; ///< Minimum number of collision candidates checked by each task when done in parallel.
+constexpr std::size_t ContactGrainSize     = 128; ///< Minimum number of contacts of a batch solved by each task when done in parallel.
+
+bool isBounded(const AABB& box) noexcept {
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    if (!std::isfinite(box.getLeftBottomBackPos()[axisIndex]) || !std::isfinite(box.getRightTopFrontPos()[axisIndex]))
+      return false;
+  }
+
+  return true;
+}
+
+// TODO: the ray/line, ray/quad & ray/OBB intersections are not implemented yet
+bool canBeHitByRay(ShapeType shapeType) noexcept {
+  return (shapeType != ShapeType::LINE && shapeType != ShapeType::QUAD && shapeType != ShapeType::OBB);
+}
+
+/// Finds the closest point on a collider's surface from a point inside its volume, or close enough to it.
+/// \param collider Collider to be checked.
+/// \param point Point to be checked, in the collider's local space.
+/// \param surfacePoint Closest point on the collider's surface to recover.
+/// \param normal Collider's normal at the surface point to recover.
+/// \return True if the point is inside the collider or closer to it than the contact margin, false otherwise or if its shape has
+///   no volume.
+bool computeClosestSurfacePoint(const Collider& collider, const Vec3f& point, Vec3f& surfacePoint, Vec3f& normal) {
+  switch (collider.getShapeType()) {
+    case ShapeType::PLANE: {
+      // Planes are one-sided, everything behind them being considered inside
+      const auto& plane  = collider.getShape<Plane>();
+      const float height = plane.getNormal().dot(point) - plane.getDistance();
+
+      if (height >= ContactMargin)
+        return false;
+
+      surfacePoint = point - plane.getNormal() * height;
+      normal       = plane.getNormal();
+      return true;
+    }
+
+    case ShapeType::SPHERE: {
+      const auto& sphere       = collider.getShape<Sphere>();
+      const Vec3f centerDir    = point - sphere.getCenter();
+      const float sqCenterDist = centerDir.computeSquaredLength();
+      const float maxDist      = sphere.getRadius() + ContactMargin;
+
+      if (sqCenterDist >= maxDist * maxDist)
+        return false;
+
+      normal       = (sqCenterDist > std::numeric_limits<float>::epsilon() ? centerDir / std::sqrt(sqCenterDist) : Axis::Y);
+      surfacePoint = sphere.getCenter() + normal * sphere.getRadius();
+      return true;
+    }
+
+    case ShapeType::AABB: {
+      const auto& box = collider.getShape<AABB>();
+
+      if (!box.contains(point)) {
+        const Vec3f boxPoint   = box.computeProjection(point);
+        const Vec3f outsideDir = point - boxPoint;
+        const float sqDist     = outsideDir.computeSquaredLength();
+
+        if (sqDist >= ContactMargin * ContactMargin || sqDist <= std::numeric_limits<float>::epsilon())
+          return false;
+
+        surfacePoint = boxPoint;
+        normal       = outsideDir / std::sqrt(sqDist);
+        return true;
+      }
+
+      // A point inside the box is moved out through the closest face
+      float minDepth           = std::numeric_limits<float>::max();
+      std::size_t minAxisIndex = 0;
+      bool isMinFaceLow        = false;
+
+      for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+        const float lowDepth  = point[axisIndex] - box.getLeftBottomBackPos()[axisIndex];
+        const float highDepth = box.getRightTopFrontPos()[axisIndex] - point[axisIndex];
+
+        if (lowDepth < minDepth) {
+          minDepth     = lowDepth;
+          minAxisIndex = axisIndex;
+          isMinFaceLow = true;
+        }
+
+        if (highDepth < minDepth) {
+          minDepth     = highDepth;
+          minAxisIndex = axisIndex;
+          isMinFaceLow = false;
+        }
+      }
+
+      surfacePoint = point;
+      surfacePoint[minAxisIndex] = (isMinFaceLow ? box.getLeftBottomBackPos() : box.getRightTopFrontPos())[minAxisIndex];
+
+      normal = Vec3f(0.f);
+      normal[minAxisIndex] = (isMinFaceLow ? -1.f : 1.f);
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+/// Computes the signed distance of a contact's body in front of its anchor, beyond the contact offset.
+/// \tparam ManifoldT Type of the contact.
+/// \param manifold Contact to compute the separation of.
+/// \return Separation of the contact's body; negative if it penetrates the collider.
+template <typename ManifoldT>
+float computeSeparation(const ManifoldT& manifold) noexcept {
+  const Vec3f anchorPos = *manifold.colliderPosition + manifold.anchor;
+  return (*manifold.position - anchorPos).dot(manifold.normal) - ContactOffset;
+}
+
+/// Processes the contacts batch after batch. The contacts of a batch sharing no movable body, they can be processed concurrently;
+///   large enough batches are thus split to be processed in parallel. The contacts that could not be colored are all in the last
+///   batch, which is always processed serially.
+/// \tparam ManifoldT Type of the contacts.
+/// \tparam FuncT Type of the function to be called on each contact.
+/// \param manifolds Contacts to be processed, sorted by batch.
+/// \param batchOffsets Index of the first contact of each batch, followed by the contact count.
+/// \param processContact Function to be called on each contact.
+template <typename ManifoldT, typename FuncT>
+void processContactBatches(std::vector<ManifoldT>& manifolds, const std::vector<std::size_t>& batchOffsets, const FuncT& processContact) {
+  for (std::size_t batchIndex = 0; batchIndex + 1 < batchOffsets.size(); ++batchIndex) {
+    const std::size_t beginIndex = batchOffsets[batchIndex];
+    const std::size_t endIndex   = batchOffsets[batchIndex + 1];
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    if (endIndex - beginIndex >= ContactGrainSize * 2 && manifolds[beginIndex].color != OverflowContactColor) {
+      Threading::getDefaultThreadPool().parallelFor(beginIndex, endIndex, [&manifolds, &processContact] (Threading::IndexRange range) {
+        for (std::size_t manifoldIndex = range.beginIndex; manifoldIndex < range.endIndex; ++manifoldIndex)
+          processContact(manifolds[manifoldIndex]);
+      }, ContactGrainSize);
+
+      continue;
+    }
+#endif
+
+    for (std::size_t manifoldIndex = beginIndex; manifoldIndex < endIndex; ++manifoldIndex)
+      processContact(manifolds[manifoldIndex]);
+  }
+}
+
+/// Integrates one axis of the bodies' velocities & positions, by packs of the given size.
+/// \tparam Size Number of bodies integrated at once.
+/// \param positions Positions of the bodies on the axis, to be updated.
+/// \param velocities Velocities of the bodies on the axis, to be updated.
+/// \param forces Forces applied to the bodies on the axis.
+/// \param invMasses Inverse masses of the bodies.
+/// \param bodyCount Number of bodies to be integrated.
+/// \param friction Friction coefficient.
+/// \param deltaTime Time step.
+/// \return Number of bodies integrated; the remaining ones are not enough to fill a pack.
+template <std::size_t Size>
+std::size_t integrateAxis(float* positions, float* velocities, const float* forces, const float* invMasses, std::size_t bodyCount,
+                          float friction, float deltaTime) noexcept {
+  using Pack = SimdUtils::FloatPack<Size>;
+
+  const Pack frictionPack(friction);
+  const Pack deltaTimePack(deltaTime);
+  const Pack halfPack(0.5f);
+
+  std::size_t bodyIndex = 0;
+
+  for (; bodyIndex + Size <= bodyCount; bodyIndex += Size) {
+    const Pack acceleration = Pack::load(forces + bodyIndex) * Pack::load(invMasses + bodyIndex);
+    const Pack oldVelocity  = Pack::load(velocities + bodyIndex);
+    const Pack velocity     = oldVelocity * frictionPack + acceleration * deltaTimePack;
+
+    velocity.store(velocities + bodyIndex);
+    (Pack::load(positions + bodyIndex) + (oldVelocity + velocity) * halfPack * deltaTimePack).store(positions + bodyIndex);
+  }
+
+  return bodyIndex;
+}
+
+} // namespace
+
 PhysicsSystem::PhysicsSystem() {
   m_acceptedComponents.setBit(Component::getId<Collider>());
   m_acceptedComponents.setBit(Component::getId<RigidBody>());
+
+  m_readComponents.setBit(Component::getId<Collider>());
+  m_writeComponents.setBit(Component::getId<RigidBody>());
+  m_writeComponents.setBit(Component::getId<Transform>());
 }
 
 bool PhysicsSystem::step(float deltaTime) {
-  for (Entity* entity : m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
-      continue;
+  assert("Error: The physics system must belong to a world to be stepped." && m_world != nullptr);
+
+  gatherBodies();
+
+  const std::size_t bodyCount = m_bodyStates.rigidBodies.size();
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (bodyCount >= IntegrationGrainSize * 2) {
+    Threading::getDefaultThreadPool().parallelFor(0, bodyCount, [this, deltaTime] (Threading::IndexRange range) {
+      integrateBodies(range.beginIndex, range.endIndex, deltaTime);
+    }, IntegrationGrainSize);
+  } else {
+    integrateBodies(0, bodyCount, deltaTime);
+  }
+#else
+  integrateBodies(0, bodyCount, deltaTime);
+#endif
+
+  solveConstraints();
+
+  if (m_isSleepingEnabled)
+    updateIslands(deltaTime);
+
+  return true;
+}
+
+bool PhysicsSystem::raycast(const Ray& ray, RaycastHit* hit, float maxDistance) const {
+  RaycastHit closestHit;
+  closestHit.rayHit.distance = maxDistance;
 
-    auto& rigidBody = entity->getComponent<RigidBody>();
-    auto& transform = entity->getComponent<Transform>();
+  // Colliders with infinite bounds are tested first, since a hit on them reduces the distance up to which the hierarchy is traversed
+  for (Entity* entity : m_unboundedColliderEntities) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(ray, *entity, colliderHit) && colliderHit.distance <= closestHit.rayHit.distance)
+      closestHit = RaycastHit{ entity, colliderHit };
+  }
+
+  m_raycastBvh.traverse(ray, [this, &ray, &closestHit] (std::size_t primitiveId, float& maxDist) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(ray, *m_raycastEntities[primitiveId], colliderHit) && colliderHit.distance <= maxDist) {
+      closestHit = RaycastHit{ m_raycastEntities[primitiveId], colliderHit };
+      maxDist    = colliderHit.distance;
+    }
+
+    return true;
+  }, closestHit.rayHit.distance);
+
+  if (closestHit.entity == nullptr)
+    return false;
+
+  if (hit)
+    *hit = closestHit;
+
+  return true;
+}
+
+std::vector<RaycastHit> PhysicsSystem::raycastAll(const Ray& ray, float maxDistance) const {
+  std::vector<RaycastHit> hits;
+
+  for (Entity* entity : m_unboundedColliderEntities) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(ray, *entity, colliderHit) && colliderHit.distance <= maxDistance)
+      hits.push_back(RaycastHit{ entity, colliderHit });
+  }
+
+  m_raycastBvh.traverse(ray, [this, &ray, &hits] (std::size_t primitiveId, float& maxDist) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(ray, *m_raycastEntities[primitiveId], colliderHit) && colliderHit.distance <= maxDist)
+      hits.push_back(RaycastHit{ m_raycastEntities[primitiveId], colliderHit });
+
+    return true;
+  }, maxDistance);
+
+  std::sort(hits.begin(), hits.end(), [] (const RaycastHit& firstHit, const RaycastHit& secondHit) {
+    return (firstHit.rayHit.distance < secondHit.rayHit.distance);
+  });
+
+  return hits;
+}
+
+std::vector<RaycastHit> PhysicsSystem::raycastMany(const std::vector<Ray>& rays, float maxDistance) const {
+  std::vector<RaycastHit> hits(rays.size());
+
+  // Each ray writing only its own hit, batches of rays can be cast concurrently
+  const auto castRays = [this, &rays, &hits, maxDistance] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t rayIndex = beginIndex; rayIndex < endIndex; ++rayIndex)
+      raycast(rays[rayIndex], &hits[rayIndex], maxDistance);
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (rays.size() >= RaycastGrainSize * 2) {
+    Threading::getDefaultThreadPool().parallelFor(0, rays.size(), [&castRays] (Threading::IndexRange range) {
+      castRays(range.beginIndex, range.endIndex);
+    }, RaycastGrainSize);
+  } else {
+    castRays(0, rays.size());
+  }
+#else
+  castRays(0, rays.size());
+#endif
+
+  return hits;
+}
+
+void PhysicsSystem::gatherBodies() {
+  const EntityView<RigidBody, Transform> bodies = m_world->view<RigidBody, Transform>();
+  const std::size_t maxBodyCount = bodies.getSize();
+
+  m_bodyStates.entityIds.resize(maxBodyCount);
+  m_bodyStates.rigidBodies.resize(maxBodyCount);
+  m_bodyStates.transforms.resize(maxBodyCount);
+  m_bodyStates.invMasses.resize(maxBodyCount);
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    m_bodyStates.positions[axisIndex].resize(maxBodyCount);
+    m_bodyStates.velocities[axisIndex].resize(maxBodyCount);
+    m_bodyStates.forces[axisIndex].resize(maxBodyCount);
+  }
+
+  std::size_t bodyIndex = 0;
+
+  bodies.forEach([this, &bodyIndex] (const Entity& entity, RigidBody& rigidBody, Transform& transform) {
+    if (rigidBody.isSleeping()) {
+      if (m_isSleepingEnabled)
+        return;
+
+      rigidBody.wakeUp();
+    }
 
     rigidBody.m_oldPosition = transform.getPosition();
     rigidBody.applyForces(m_gravity);
 
-    const Vec3f acceleration = rigidBody.getForces() * rigidBody.getInvMass();
-    const Vec3f oldVelocity  = rigidBody.getVelocity();
+    // A body which has just started moving, or has just been woken up, starts resting from its current position
+    if (rigidBody.m_restingTime == 0.f)
+      rigidBody.m_restingPosition = transform.getPosition();
+
+    m_bodyStates.entityIds[bodyIndex]   = entity.getId();
+    m_bodyStates.rigidBodies[bodyIndex] = &rigidBody;
+    m_bodyStates.transforms[bodyIndex]  = &transform;
+    m_bodyStates.invMasses[bodyIndex]   = rigidBody.getInvMass();
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      m_bodyStates.positions[axisIndex][bodyIndex]  = transform.getPosition()[axisIndex];
+      m_bodyStates.velocities[axisIndex][bodyIndex] = rigidBody.getVelocity()[axisIndex];
+      m_bodyStates.forces[axisIndex][bodyIndex]     = rigidBody.getForces()[axisIndex];
+    }
+
+    ++bodyIndex;
+  });
 
-    const Vec3f velocity = oldVelocity * m_friction + acceleration * deltaTime;
-    rigidBody.setVelocity(velocity);
+  // Only the awake bodies are kept
+  m_bodyStates.entityIds.resize(bodyIndex);
+  m_bodyStates.rigidBodies.resize(bodyIndex);
+  m_bodyStates.transforms.resize(bodyIndex);
+  m_bodyStates.invMasses.resize(bodyIndex);
 
-    transform.translate((oldVelocity + velocity) * 0.5f * deltaTime);
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    m_bodyStates.positions[axisIndex].resize(bodyIndex);
+    m_bodyStates.velocities[axisIndex].resize(bodyIndex);
+    m_bodyStates.forces[axisIndex].resize(bodyIndex);
   }
 
-  solveConstraints();
+  m_awakeBodyCount    = bodyIndex;
+  m_sleepingBodyCount = maxBodyCount - bodyIndex;
+}
+
+void PhysicsSystem::integrateBodies(std::size_t beginIndex, std::size_t endIndex, float deltaTime) {
+  const std::size_t bodyCount = endIndex - beginIndex;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    float* positions       = m_bodyStates.positions[axisIndex].data() + beginIndex;
+    float* velocities      = m_bodyStates.velocities[axisIndex].data() + beginIndex;
+    const float* forces    = m_bodyStates.forces[axisIndex].data() + beginIndex;
+    const float* invMasses = m_bodyStates.invMasses.data() + beginIndex;
+
+    // The bodies not filling a whole pack are integrated one by one
+    const std::size_t packedCount = integrateAxis<PackSize>(positions, velocities, forces, invMasses, bodyCount, m_friction, deltaTime);
+    integrateAxis<1>(positions + packedCount, velocities + packedCount, forces + packedCount, invMasses + packedCount,
+                     bodyCount - packedCount, m_friction, deltaTime);
+  }
+
+  // The velocity is directly assigned, since RigidBody::setVelocity() would reset the body's resting time
+  for (std::size_t bodyIndex = beginIndex; bodyIndex < endIndex; ++bodyIndex) {
+    m_bodyStates.rigidBodies[bodyIndex]->m_velocity = Vec3f(m_bodyStates.velocities[0][bodyIndex],
+                                                            m_bodyStates.velocities[1][bodyIndex],
+                                                            m_bodyStates.velocities[2][bodyIndex]);
+    m_bodyStates.transforms[bodyIndex]->setPosition(m_bodyStates.positions[0][bodyIndex],
+                                                    m_bodyStates.positions[1][bodyIndex],
+                                                    m_bodyStates.positions[2][bodyIndex]);
+  }
+}
+
+bool PhysicsSystem::findContact(Entity& movingEntity, Entity& colliderEntity, ContactManifold& manifold) {
+  auto& rigidBody         = movingEntity.getComponent<RigidBody>();
+  auto& transform         = movingEntity.getComponent<Transform>();
+  const auto& collider    = colliderEntity.getComponent<Collider>();
+  auto& colliderTransform = colliderEntity.getComponent<Transform>();
+
+  // A sleeping body is not moved during the step it is woken up in; its collider is thus immovable until the next one
+  RigidBody* colliderBody = (colliderEntity.hasComponent<RigidBody>() ? &colliderEntity.getComponent<RigidBody>() : nullptr);
+  if (colliderBody && colliderBody->isSleeping())
+    colliderBody = nullptr;
+
+  // Immovable colliders stop any body, even one with an infinite mass; two bodies with an infinite mass do not affect each other
+  manifold.invMass         = (colliderBody == nullptr && rigidBody.getInvMass() == 0.f ? 1.f : rigidBody.getInvMass());
+  manifold.colliderInvMass = (colliderBody ? colliderBody->getInvMass() : 0.f);
+
+  if (manifold.invMass + manifold.colliderInvMass == 0.f)
+    return false;
+
+  if (isShapeSwept(movingEntity, rigidBody)) {
+    SweepHit hit;
+    if (!sweepBody(rigidBody, transform, movingEntity.getComponent<Collider>(), collider, colliderTransform, hit))
+      return false;
+
+    const Vec3f movement = transform.getPosition() - rigidBody.m_oldPosition;
+    manifold.anchor = rigidBody.m_oldPosition + movement * hit.time - colliderTransform.getPosition();
+    manifold.normal = hit.normal;
+  } else if (!findPointContact(rigidBody, transform, collider, colliderTransform, manifold.anchor, manifold.normal)) {
+    return false;
+  }
+
+  //                                     Vt/paraVec
+  //  Vel  N  Refl                  \---->
+  //    \  ^  ^                     | \          Vn is the velocity's perpendicular component to the surface
+  //     \ | /        ->            |   \        Vt is the velocity's parallel component to the surface
+  // _____v|/______      Vn/perpVec v    v Vel
+  //
+  // Once the contact is solved, the relative velocity's perpendicular component is reversed & scaled by the bounciness
+
+  const Vec3f colliderVelocity = (colliderBody ? colliderBody->getVelocity() : Vec3f(0.f));
+  const float normalSpeed      = (rigidBody.getVelocity() - colliderVelocity).dot(manifold.normal);
+
+  manifold.rigidBody         = &rigidBody;
+  manifold.transform         = &transform;
+  manifold.colliderBody      = colliderBody;
+  manifold.colliderTransform = &colliderTransform;
+  manifold.targetSpeed       = (normalSpeed < 0.f ? -normalSpeed * rigidBody.getBounciness() : 0.f);
+
+  return true;
+}
+
+bool PhysicsSystem::findPointContact(const RigidBody& rigidBody, const Transform& transform, const Collider& collider,
+                                     const Transform& colliderTransform, Vec3f& anchor, Vec3f& normal) {
+  // The collision detection is made in the collider's local space
+  // The tested positions must thus be translated into that space
+  const Vec3f colliderPos    = colliderTransform.getPosition();
+  const Vec3f movement       = transform.getPosition() - rigidBody.m_oldPosition;
+  const float movementLength = movement.computeLength();
+
+  if (movementLength > 0.f && canBeHitByRay(collider.getShapeType())) {
+    // Casting a ray along the last movement finds both if the body went through the collider, even if it has travelled fast
+    //  enough to end behind it, & where it has hit it
+    const Ray ray(rigidBody.m_oldPosition - colliderPos, movement / movementLength);
+    RayHit hit;
+
+    // A ray starting inside the collider hits its surface from behind, which is not a contact
+    if (collider.intersects(ray, &hit) && hit.distance <= movementLength && hit.normal.dot(ray.getDirection()) < 0.f) {
+      anchor = hit.position;
+      normal = hit.normal;
+      return true;
+    }
+  }
+
+  // Without crossing its surface, the body may still be close to the collider, like when resting on it, or even have ended up
+  //  inside it, for example when pushed by another body. Such a contact only constrains the body once it is touching the collider
+  return computeClosestSurfacePoint(collider, transform.getPosition() - colliderPos, anchor, normal);
+}
+
+bool PhysicsSystem::sweepBody(const RigidBody& rigidBody, const Transform& transform, const Collider& bodyCollider,
+                              const Collider& collider, const Transform& colliderTransform, SweepHit& hit) {
+  const Vec3f movement = transform.getPosition() - rigidBody.m_oldPosition;
+
+  // The body's shape is swept from its previous position, translated into the collider's local space
+  const Vec3f localStartPos = rigidBody.m_oldPosition - colliderTransform.getPosition();
+
+  if (bodyCollider.getShapeType() == ShapeType::SPHERE) {
+    const auto& sphere = bodyCollider.getShape<Sphere>();
+    return ShapeSweep::computeTimeOfImpact(Sphere(sphere.getCenter() + localStartPos, sphere.getRadius()), movement, collider.getShape(), &hit);
+  }
+
+  const auto& box = bodyCollider.getShape<AABB>();
+  return ShapeSweep::computeTimeOfImpact(AABB(box.getLeftBottomBackPos() + localStartPos, box.getRightTopFrontPos() + localStartPos),
+                                         movement,
+                                         collider.getShape(),
+                                         &hit);
+}
+
+bool PhysicsSystem::isShapeSwept(const Entity& entity, const RigidBody& rigidBody) {
+  if (!rigidBody.isCcdEnabled() || !entity.hasComponent<Collider>())
+    return false;
+
+  const ShapeType shapeType = entity.getComponent<Collider>().getShapeType();
+  return (shapeType == ShapeType::SPHERE || shapeType == ShapeType::AABB);
+}
+
+void PhysicsSystem::updateBroadphase() {
+  m_proxyEntities.clear();
+  m_unboundedColliderEntities.clear();
+  ++m_raycastUpdateIndex;
+
+  // Each entity can own two proxies: one for its collider & one for its movement during the last step, the latter always
+  //  having an odd ID. Only pairs associating a collider with a movement are of interest
+  m_world->view<Collider, Transform>().forEach([this] (Entity& entity, const Collider& collider, const Transform& transform) {
+    if (entity.getId() >= m_proxyEntities.size())
+      m_proxyEntities.resize(entity.getId() + 1);
+
+    m_proxyEntities[entity.getId()] = &entity;
+
+    const AABB shapeBox      = collider.computeBoundingBox();
+    const Vec3f& colliderPos = transform.getPosition();
+    const AABB colliderBox(shapeBox.getLeftBottomBackPos() + colliderPos, shapeBox.getRightTopFrontPos() + colliderPos);
+
+    m_broadphase.setProxy(entity.getId() * 2, colliderBox, ColliderProxyCategory, MovementProxyCategory);
+    updateRaycastCollider(entity, colliderBox);
+  });
+
+  removeStaleRaycastColliders();
+
+  // Sleeping bodies are not moving, & thus have no movement proxy; their former one is removed as a stale proxy
+  m_world->view<RigidBody, Transform>().forEach([this] (Entity& entity, const RigidBody& rigidBody, const Transform& transform) {
+    if (rigidBody.isSleeping())
+      return;
+
+    if (entity.getId() >= m_proxyEntities.size())
+      m_proxyEntities.resize(entity.getId() + 1);
+
+    m_proxyEntities[entity.getId()] = &entity;
+
+    // The movement is extended by the contact margin, so that the colliders close to the body are found as well
+    const AABB lineBox = Line(rigidBody.m_oldPosition, transform.getPosition()).computeBoundingBox();
+    AABB movementBox(lineBox.getLeftBottomBackPos() - Vec3f(ContactMargin), lineBox.getRightTopFrontPos() + Vec3f(ContactMargin));
+
+    // A swept shape covers the whole volume between its previous & current positions
+    if (isShapeSwept(entity, rigidBody)) {
+      const AABB shapeBox = entity.getComponent<Collider>().computeBoundingBox();
+      movementBox = AABB(movementBox.getLeftBottomBackPos() + shapeBox.getLeftBottomBackPos(),
+                         movementBox.getRightTopFrontPos() + shapeBox.getRightTopFrontPos());
+    }
+
+    m_broadphase.setProxy(entity.getId() * 2 + 1, movementBox, MovementProxyCategory, ColliderProxyCategory);
+  });
+}
+
+void PhysicsSystem::updateRaycastCollider(Entity& entity, const AABB& box) {
+  // Colliders with infinite bounds would make the hierarchy useless, & are thus kept aside
+  if (!isBounded(box)) {
+    m_unboundedColliderEntities.emplace_back(&entity);
+    return;
+  }
+
+  if (entity.getId() >= m_raycastPrimitives.size())
+    m_raycastPrimitives.resize(entity.getId() + 1);
+
+  RaycastPrimitive& primitive = m_raycastPrimitives[entity.getId()];
+  primitive.lastUpdate = m_raycastUpdateIndex;
+
+  if (primitive.primitiveId == Bvh::InvalidId) {
+    primitive.primitiveId = m_raycastBvh.insert(box);
+    ++m_raycastInsertionCount;
+
+    if (primitive.primitiveId >= m_raycastEntities.size())
+      m_raycastEntities.resize(primitive.primitiveId + 1);
+  } else {
+    const AABB& primitiveBox = m_raycastBvh.getPrimitiveBox(primitive.primitiveId);
+
+    // Colliders that have not moved are left untouched, avoiding to refit the boxes containing them
+    if (primitiveBox.getLeftBottomBackPos() != box.getLeftBottomBackPos() || primitiveBox.getRightTopFrontPos() != box.getRightTopFrontPos())
+      m_raycastBvh.update(primitive.primitiveId, box);
+  }
+
+  m_raycastEntities[primitive.primitiveId] = &entity;
+}
 
+void PhysicsSystem::removeStaleRaycastColliders() {
+  for (RaycastPrimitive& primitive : m_raycastPrimitives) {
+    if (primitive.primitiveId == Bvh::InvalidId || primitive.lastUpdate == m_raycastUpdateIndex)
+      continue;
+
+    m_raycastBvh.remove(primitive.primitiveId);
+    m_raycastEntities[primitive.primitiveId] = nullptr;
+    primitive.primitiveId = Bvh::InvalidId;
+  }
+
+  // Incremental insertions give a lower quality tree than a full build; it is thus rebuilt once many colliders have been added
+  if (m_raycastInsertionCount * 4 > m_raycastBvh.getPrimitiveCount()) {
+    m_raycastBvh.build();
+    m_raycastInsertionCount = 0;
+  }
+}
+
+bool PhysicsSystem::intersectsCollider(const Ray& ray, const Entity& entity, RayHit& hit) {
+  const Collider& collider = entity.getComponent<Collider>();
+
+  if (!canBeHitByRay(collider.getShapeType()))
+    return false;
+
+  // Like collisions, the ray is tested in the collider's local space
+  const Vec3f& colliderPos = entity.getComponent<Transform>().getPosition();
+
+  if (!collider.intersects(Ray(ray.getOrigin() - colliderPos, ray.getDirection()), &hit))
+    return false;
+
+  hit.position += colliderPos;
   return true;
 }
 
 void PhysicsSystem::solveConstraints() {
-  for (Entity* entity : m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
+  updateBroadphase();
+
+  m_collisionCandidates.clear();
+  m_bodyContacts.clear();
+
+  for (const auto& [firstProxyId, secondProxyId] : m_broadphase.computeOverlappingPairs()) {
+    const bool isFirstMovement = (firstProxyId % 2 == 1);
+
+    const std::size_t movingEntityId   = (isFirstMovement ? firstProxyId : secondProxyId) / 2;
+    const std::size_t colliderEntityId = (isFirstMovement ? secondProxyId : firstProxyId) / 2;
+
+    if (movingEntityId != colliderEntityId)
+      m_collisionCandidates.emplace_back(movingEntityId, colliderEntityId);
+  }
+
+  // Sorting the candidates by entity IDs, so that the contacts found from them are sorted like the cached impulses
+  std::sort(m_collisionCandidates.begin(), m_collisionCandidates.end());
+
+  generateContactManifolds();
+  colorContactManifolds();
+
+  // The penetrations are solved first, moving the bodies back in front of the colliders
+  for (std::size_t iterationIndex = 0; iterationIndex < m_solverIterationCount; ++iterationIndex)
+    processContactBatches(m_contactManifolds, m_contactBatchOffsets, [] (ContactManifold& manifold) { solveContactPosition(manifold); });
+
+  // Bodies having several contacts are checked multiple times, but their transform is updated only once
+  for (const ContactManifold& manifold : m_contactManifolds) {
+    if (!manifold.transform->getPosition().strictlyEquals(*manifold.position))
+      manifold.transform->setPosition(*manifold.position);
+
+    if (manifold.colliderBody && !manifold.colliderTransform->getPosition().strictlyEquals(*manifold.colliderPosition))
+      manifold.colliderTransform->setPosition(*manifold.colliderPosition);
+  }
+
+  // Only the contacts whose body still touches the collider constrain the velocities; they start from their last step's impulse
+  processContactBatches(m_contactManifolds, m_contactBatchOffsets, [] (ContactManifold& manifold) {
+    manifold.isTouching = (computeSeparation(manifold) <= TouchingTolerance);
+
+    if (!manifold.isTouching)
+      manifold.normalImpulse = 0.f;
+
+    applyContactImpulse(manifold, manifold.normalImpulse);
+  });
+
+  for (std::size_t iterationIndex = 0; iterationIndex < m_solverIterationCount; ++iterationIndex)
+    processContactBatches(m_contactManifolds, m_contactBatchOffsets, [] (ContactManifold& manifold) { solveContactVelocity(manifold); });
+
+  cacheContactImpulses();
+}
+
+void PhysicsSystem::generateContactManifolds() {
+  m_contactManifolds.resize(m_collisionCandidates.size());
+
+  // Each candidate writing only its own contact, & no body being moved yet, the candidates can be checked concurrently
+  const auto findContacts = [this] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t candidateIndex = beginIndex; candidateIndex < endIndex; ++candidateIndex) {
+      const auto [movingEntityId, colliderEntityId] = m_collisionCandidates[candidateIndex];
+
+      ContactManifold& manifold = m_contactManifolds[candidateIndex];
+      manifold = ContactManifold{ movingEntityId, colliderEntityId };
+
+      if (!findContact(*m_proxyEntities[movingEntityId], *m_proxyEntities[colliderEntityId], manifold))
+        manifold.rigidBody = nullptr;
+    }
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_collisionCandidates.size() >= NarrowphaseGrainSize * 2) {
+    Threading::getDefaultThreadPool().parallelFor(0, m_collisionCandidates.size(), [&findContacts] (Threading::IndexRange range) {
+      findContacts(range.beginIndex, range.endIndex);
+    }, NarrowphaseGrainSize);
+  } else {
+    findContacts(0, m_collisionCandidates.size());
+  }
+#else
+  findContacts(0, m_collisionCandidates.size());
+#endif
+
+  std::size_t contactCount = 0;
+  std::size_t cachedImpulseIndex = 0;
+
+  for (const ContactManifold& manifold : m_contactManifolds) {
+    if (manifold.rigidBody == nullptr)
       continue;
 
-    auto& rigidBody = entity->getComponent<RigidBody>();
-    auto& transform = entity->getComponent<Transform>();
+    Entity& colliderEntity = *m_proxyEntities[manifold.colliderEntityId];
 
-    const Vec3f velocity    = rigidBody.getVelocity();
-    const Vec3f velocityDir = velocity.normalize();
+    if (colliderEntity.hasComponent<RigidBody>()) {
+      auto& colliderBody = colliderEntity.getComponent<RigidBody>();
 
-    for (Entity* collidableEntity : m_entities) {
-      if (collidableEntity == entity || !collidableEntity->isEnabled() || !collidableEntity->hasComponent<Collider>())
-        continue;
+      if (!colliderBody.isSleeping()) {
+        m_bodyContacts.emplace_back(manifold.bodyEntityId, manifold.colliderEntityId);
+      } else {
+        // A sleeping body hit by an awake one is woken up; it will be integrated from the next step on. A body merely close to
+        //  it does not wake it up
+        const Vec3f anchorPos = manifold.colliderTransform->getPosition() + manifold.anchor;
 
-      assert("Error: A collidable entity must have a Transform component." && collidableEntity->hasComponent<Transform>());
+        if ((manifold.transform->getPosition() - anchorPos).dot(manifold.normal) - ContactOffset <= TouchingTolerance)
+          colliderBody.wakeUp();
+      }
+    }
 
-      auto& collider = collidableEntity->getComponent<Collider>();
+    ContactManifold& contact = m_contactManifolds[contactCount++];
+    contact = manifold;
 
-      // The collision detection is made in the collider's local space
-      // The test shapes/rays must thus be translated into that space
-      const Vec3f colliderPos   = collidableEntity->getComponent<Transform>().getPosition();
-      const Vec3f localStartPos = rigidBody.m_oldPosition - colliderPos;
+    // Both the contacts & the cached impulses being sorted by entity IDs, the impulse of the same contact during the last step
+    //  is found by walking along them together. It is reused only if the contact's normal has not changed much since
+    const auto contactIds = std::make_pair(contact.bodyEntityId, contact.colliderEntityId);
 
-      // We first try to determine if the last movement gave an intersection
-      // This is necessary in case our object has travelled too fast right through the collider,
-      //  ending behind it
-      const Line movementLine(localStartPos, transform.getPosition() - colliderPos);
-      if (!collider.intersects(movementLine))
-        continue;
+    while (cachedImpulseIndex < m_cachedImpulses.size()
+        && std::make_pair(m_cachedImpulses[cachedImpulseIndex].bodyEntityId, m_cachedImpulses[cachedImpulseIndex].colliderEntityId) < contactIds) {
+      ++cachedImpulseIndex;
+    }
 
-      const Ray ray(localStartPos, velocityDir);
+    if (cachedImpulseIndex == m_cachedImpulses.size())
+      continue;
 
-      RayHit hit;
-      if (!collider.intersects(ray, &hit))
-        continue;
+    const CachedImpulse& cachedImpulse = m_cachedImpulses[cachedImpulseIndex];
 
-      // Setting the entity's new position a little above the collision point
-      const Vec3f newPos = hit.position + hit.normal * 0.002f + colliderPos;
+    if (cachedImpulse.bodyEntityId == contact.bodyEntityId && cachedImpulse.colliderEntityId == contact.colliderEntityId
+        && cachedImpulse.normal.dot(contact.normal) >= WarmStartNormalThreshold) {
+      contact.normalImpulse = cachedImpulse.normalImpulse;
+    }
+  }
 
-      rigidBody.m_oldPosition = newPos;
-      transform.setPosition(newPos);
+  m_contactManifolds.resize(contactCount);
 
-      //                                     Vt/paraVec
-      //  Vel  N  Refl                  \---->
-      //    \  ^  ^                     | \          Vn is the velocity's perpendicular component to the surface
-      //     \ | /        ->            |   \        Vt is the velocity's parallel component to the surface
-      // _____v|/______      Vn/perpVec v    v Vel
+  m_solverPositions.resize(m_proxyEntities.size());
 
-      const Vec3f paraVec = hit.normal * velocity.dot(hit.normal);
-      const Vec3f perpVec = velocity - paraVec;
+  for (ContactManifold& manifold : m_contactManifolds) {
+    manifold.position         = &m_solverPositions[manifold.bodyEntityId];
+    manifold.colliderPosition = &m_solverPositions[manifold.colliderEntityId];
 
-      rigidBody.setVelocity(perpVec - paraVec * rigidBody.getBounciness());
+    *manifold.position         = manifold.transform->getPosition();
+    *manifold.colliderPosition = manifold.colliderTransform->getPosition();
+  }
+}
+
+void PhysicsSystem::colorContactManifolds() {
+  m_bodyColorMasks.assign(m_proxyEntities.size(), 0);
+
+  // Each contact is given the first color none of the other contacts of its bodies has; immovable colliders are never written to,
+  //  & thus do not prevent contacts from being solved concurrently
+  for (ContactManifold& manifold : m_contactManifolds) {
+    uint64_t usedColors = m_bodyColorMasks[manifold.bodyEntityId];
+
+    if (manifold.colliderBody)
+      usedColors |= m_bodyColorMasks[manifold.colliderEntityId];
 
-      break;
+    if (usedColors == std::numeric_limits<uint64_t>::max()) {
+      manifold.color = OverflowContactColor;
+      continue;
     }
+
+    manifold.color = 0;
+    while (usedColors & (uint64_t(1) << manifold.color))
+      ++manifold.color;
+
+    const uint64_t colorBit = uint64_t(1) << manifold.color;
+    m_bodyColorMasks[manifold.bodyEntityId] |= colorBit;
+
+    if (manifold.colliderBody)
+      m_bodyColorMasks[manifold.colliderEntityId] |= colorBit;
   }
+
+  std::stable_sort(m_contactManifolds.begin(), m_contactManifolds.end(), [] (const ContactManifold& manifold1, const ContactManifold& manifold2) {
+    return (manifold1.color < manifold2.color);
+  });
+
+  m_contactBatchOffsets.clear();
+
+  for (std::size_t manifoldIndex = 0; manifoldIndex < m_contactManifolds.size(); ++manifoldIndex) {
+    if (manifoldIndex == 0 || m_contactManifolds[manifoldIndex].color != m_contactManifolds[manifoldIndex - 1].color)
+      m_contactBatchOffsets.emplace_back(manifoldIndex);
+  }
+
+  m_contactBatchOffsets.emplace_back(m_contactManifolds.size());
+}
+
+void PhysicsSystem::solveContactPosition(ContactManifold& manifold) {
+  const float separation = computeSeparation(manifold);
+
+  if (separation >= 0.f)
+    return;
+
+  // The penetration is split between the body & the collider according to their masses
+  const float correction = -separation / (manifold.invMass + manifold.colliderInvMass);
+
+  *manifold.position += manifold.normal * (correction * manifold.invMass);
+
+  if (manifold.colliderBody)
+    *manifold.colliderPosition -= manifold.normal * (correction * manifold.colliderInvMass);
+}
+
+void PhysicsSystem::solveContactVelocity(ContactManifold& manifold) {
+  if (!manifold.isTouching)
+    return;
+
+  const Vec3f colliderVelocity = (manifold.colliderBody ? manifold.colliderBody->m_velocity : Vec3f(0.f));
+  const float normalSpeed      = (manifold.rigidBody->m_velocity - colliderVelocity).dot(manifold.normal);
+  const float impulse          = (manifold.targetSpeed - normalSpeed) / (manifold.invMass + manifold.colliderInvMass);
+
+  // The contact can only push the body away from the collider. Clamping the accumulated impulse rather than each iteration's
+  //  lets later iterations take back part of what earlier ones have applied
+  const float normalImpulse = std::max(manifold.normalImpulse + impulse, 0.f);
+  applyContactImpulse(manifold, normalImpulse - manifold.normalImpulse);
+  manifold.normalImpulse = normalImpulse;
+}
+
+void PhysicsSystem::applyContactImpulse(ContactManifold& manifold, float impulse) {
+  // The velocity is directly assigned, since RigidBody::applyImpulse() would reset the body's resting time
+  manifold.rigidBody->m_velocity += manifold.normal * (impulse * manifold.invMass);
+
+  if (manifold.colliderBody)
+    manifold.colliderBody->m_velocity -= manifold.normal * (impulse * manifold.colliderInvMass);
+}
+
+void PhysicsSystem::cacheContactImpulses() {
+  m_cachedImpulses.clear();
+
+  for (const ContactManifold& manifold : m_contactManifolds) {
+    if (manifold.normalImpulse > 0.f)
+      m_cachedImpulses.push_back(CachedImpulse{ manifold.bodyEntityId, manifold.colliderEntityId, manifold.normal, manifold.normalImpulse });
+  }
+
+  std::sort(m_cachedImpulses.begin(), m_cachedImpulses.end(), [] (const CachedImpulse& impulse1, const CachedImpulse& impulse2) {
+    return (std::make_pair(impulse1.bodyEntityId, impulse1.colliderEntityId) < std::make_pair(impulse2.bodyEntityId, impulse2.colliderEntityId));
+  });
+}
+
+void PhysicsSystem::updateIslands(float deltaTime) {
+  const std::size_t bodyCount = m_bodyStates.rigidBodies.size();
+
+  // Each awake body starts in its own island; the entities not being awake bodies have no parent
+  m_islandParents.assign(m_proxyEntities.size(), std::numeric_limits<std::size_t>::max());
+
+  for (const std::size_t entityId : m_bodyStates.entityIds) {
+    if (entityId >= m_islandParents.size())
+      m_islandParents.resize(entityId + 1, std::numeric_limits<std::size_t>::max());
+
+    m_islandParents[entityId] = entityId;
+  }
+
+  for (const auto& [firstEntityId, secondEntityId] : m_bodyContacts) {
+    // The contacted body may have been woken up during this step, in which case it has not been gathered yet
+    if (m_islandParents[secondEntityId] == std::numeric_limits<std::size_t>::max())
+      continue;
+
+    m_islandParents[findIslandRoot(firstEntityId)] = findIslandRoot(secondEntityId);
+  }
+
+  // Since collisions move the bodies back, a body resting on another is jittering & its velocity keeps being reset
+  // A body is thus considered resting as long as it stays close enough to the position it started resting at, its average speed
+  //  over the sleep time being under the threshold
+  const float maxRestingDistance = m_sleepSpeedThreshold * m_sleepTime;
+
+  m_islandRestingTimes.assign(m_islandParents.size(), std::numeric_limits<float>::max());
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    RigidBody& rigidBody  = *m_bodyStates.rigidBodies[bodyIndex];
+    const Vec3f& position = m_bodyStates.transforms[bodyIndex]->getPosition();
+
+    if ((position - rigidBody.m_restingPosition).computeSquaredLength() <= maxRestingDistance * maxRestingDistance) {
+      rigidBody.m_restingTime += deltaTime;
+    } else {
+      rigidBody.m_restingPosition = position;
+      rigidBody.m_restingTime     = 0.f;
+    }
+
+    float& islandRestingTime = m_islandRestingTimes[findIslandRoot(m_bodyStates.entityIds[bodyIndex])];
+    islandRestingTime = std::min(islandRestingTime, rigidBody.m_restingTime);
+  }
+
+  // An island is put to sleep only if all its bodies have been resting for long enough
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    if (m_islandRestingTimes[findIslandRoot(m_bodyStates.entityIds[bodyIndex])] < m_sleepTime)
+      continue;
+
+    RigidBody& rigidBody = *m_bodyStates.rigidBodies[bodyIndex];
+    rigidBody.m_isSleeping = true;
+    rigidBody.m_velocity   = Vec3f(0.f);
+
+    --m_awakeBodyCount;
+    ++m_sleepingBodyCount;
+  }
+}
+
+std::size_t PhysicsSystem::findIslandRoot(std::size_t entityId) {
+  std::size_t rootId = entityId;
+  while (m_islandParents[rootId] != rootId)
+    rootId = m_islandParents[rootId];
+
+  while (m_islandParents[entityId] != rootId) {
+    const std::size_t parentId = m_islandParents[entityId];
+    m_islandParents[entityId]  = rootId;
+    entityId = parentId;
+  }
+
+  return rootId;
 }
 
 } // namespace Raz
@@ -0,0 +1,247 @@
+#include "RaZ/Physics/ShapeSweep.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Raz::ShapeSweep {
+
+namespace {
+
+constexpr float DistanceTolerance = 0.0005f; ///< Distance under which shapes are considered touching.
+constexpr int MaxAdvancementCount = 32; ///< Maximum number of conservative advancement iterations.
+
+bool setHit(SweepHit* hit, float time, const Vec3f& normal) noexcept {
+  if (hit) {
+    hit->time   = time;
+    hit->normal = normal;
+  }
+
+  return true;
+}
+
+/// Computes the contact normal from the separation between a moving shape & an obstacle.
+/// \param separation Vector going from the obstacle to the moving shape.
+/// \param translation Movement of the shape, used if the separation is too small to give a direction.
+/// \return Contact normal.
+Vec3f computeContactNormal(const Vec3f& separation, const Vec3f& translation) {
+  const float sqSeparation = separation.computeSquaredLength();
+
+  if (sqSeparation > std::numeric_limits<float>::epsilon())
+    return separation / std::sqrt(sqSeparation);
+
+  return -translation.normalize();
+}
+
+/// Sweeps a shape of the given radius along the plane's normal against a plane; its distance to the plane varies linearly.
+bool sweepAgainstPlane(const Vec3f& center, float radius, const Vec3f& translation, const Plane& plane, SweepHit* hit) {
+  const float centerDist    = plane.getNormal().dot(center) - plane.getDistance();
+  const float approachSpeed = -plane.getNormal().dot(translation);
+
+  if (centerDist < 0.f || approachSpeed <= 0.f)
+    return false;
+
+  const float time = std::max((centerDist - radius) / approachSpeed, 0.f);
+
+  if (time > 1.f)
+    return false;
+
+  return setHit(hit, time, plane.getNormal());
+}
+
+bool sweepSphereAgainstSphere(const Vec3f& center, float radius, const Vec3f& translation, const Sphere& obstacle, SweepHit* hit) {
+  // Solving |relPos + translation * t| = radiusSum, a quadratic equation in t
+  const Vec3f relPos    = center - obstacle.getCenter();
+  const float radiusSum = radius + obstacle.getRadius();
+
+  const float halfB = relPos.dot(translation);
+
+  if (halfB >= 0.f) // The sphere is not moving towards the obstacle
+    return false;
+
+  const float c = relPos.dot(relPos) - radiusSum * radiusSum;
+
+  if (c <= 0.f)
+    return setHit(hit, 0.f, computeContactNormal(relPos, translation));
+
+  const float a            = translation.dot(translation);
+  const float discriminant = halfB * halfB - a * c;
+
+  if (discriminant < 0.f)
+    return false;
+
+  const float time = (-halfB - std::sqrt(discriminant)) / a;
+
+  if (time > 1.f)
+    return false;
+
+  return setHit(hit, time, computeContactNormal(relPos + translation * time, translation));
+}
+
+/// Sweeps a sphere against any shape able to project a point onto itself, by conservative advancement.
+bool advanceSphere(const Vec3f& center, float radius, const Vec3f& translation, const Shape& obstacle, SweepHit* hit) {
+  const float length = translation.computeLength();
+
+  if (length == 0.f)
+    return false;
+
+  float time = 0.f;
+  Vec3f separation;
+
+  for (int advancementIndex = 0; advancementIndex < MaxAdvancementCount; ++advancementIndex) {
+    const Vec3f position = center + translation * time;
+    separation = position - obstacle.computeProjection(position);
+
+    const float sqSeparation = separation.computeSquaredLength();
+
+    // The center is inside the obstacle
+    if (sqSeparation <= std::numeric_limits<float>::epsilon())
+      return setHit(hit, time, computeContactNormal(separation, translation));
+
+    const float distance = std::sqrt(sqSeparation) - radius;
+
+    if (distance <= DistanceTolerance) {
+      // Already touching the obstacle but moving away from it (or alongside it) is not a contact
+      if (time == 0.f && separation.dot(translation) >= 0.f)
+        return false;
+
+      return setHit(hit, time, computeContactNormal(separation, translation));
+    }
+
+    // The sphere cannot approach the obstacle faster than it moves; moving it by its distance thus never makes it go through
+    time += distance / length;
+
+    if (time > 1.f)
+      return false;
+  }
+
+  // The advancement has not converged, which happens when moving nearly alongside the obstacle; stopping there is conservative
+  return setHit(hit, time, computeContactNormal(separation, translation));
+}
+
+bool sweepBoxAgainstBox(const AABB& box, const Vec3f& translation, const AABB& obstacle, SweepHit* hit) {
+  // The box's center is cast as a ray against the obstacle expanded by the box's half extents (their Minkowski sum)
+  const Vec3f center      = box.computeCentroid();
+  const Vec3f halfExtents = box.computeHalfExtents();
+  const Vec3f minPos      = obstacle.getLeftBottomBackPos() - halfExtents;
+  const Vec3f maxPos      = obstacle.getRightTopFrontPos() + halfExtents;
+
+  float entryTime = -std::numeric_limits<float>::max();
+  float exitTime  = std::numeric_limits<float>::max();
+  std::size_t entryAxis = 0;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    if (translation[axisIndex] == 0.f) {
+      if (center[axisIndex] < minPos[axisIndex] || center[axisIndex] > maxPos[axisIndex])
+        return false;
+
+      continue;
+    }
+
+    const float invTranslation = 1.f / translation[axisIndex];
+    float nearTime = (minPos[axisIndex] - center[axisIndex]) * invTranslation;
+    float farTime  = (maxPos[axisIndex] - center[axisIndex]) * invTranslation;
+
+    if (nearTime > farTime)
+      std::swap(nearTime, farTime);
+
+    if (nearTime > entryTime) {
+      entryTime = nearTime;
+      entryAxis = axisIndex;
+    }
+
+    exitTime = std::min(exitTime, farTime);
+  }
+
+  if (entryTime > exitTime || exitTime < 0.f || entryTime > 1.f)
+    return false;
+
+  // Boxes already overlapping only touch if the box is moving towards the obstacle's center
+  if (entryTime < 0.f && (obstacle.computeCentroid() - center).dot(translation) <= 0.f)
+    return false;
+
+  Vec3f normal(0.f);
+  normal[entryAxis] = (translation[entryAxis] > 0.f ? -1.f : 1.f);
+
+  return setHit(hit, std::max(entryTime, 0.f), normal);
+}
+
+} // namespace
+
+bool computeTimeOfImpact(const Sphere& sphere, const Vec3f& translation, const Shape& obstacle, SweepHit* hit) {
+  if (translation == Vec3f(0.f))
+    return false;
+
+  switch (obstacle.getType()) {
+    case ShapeType::PLANE:
+      return sweepAgainstPlane(sphere.getCenter(), sphere.getRadius(), translation, static_cast<const Plane&>(obstacle), hit);
+
+    case ShapeType::SPHERE:
+      return sweepSphereAgainstSphere(sphere.getCenter(), sphere.getRadius(), translation, static_cast<const Sphere&>(obstacle), hit);
+
+    case ShapeType::LINE:
+    case ShapeType::AABB:
+      return advanceSphere(sphere.getCenter(), sphere.getRadius(), translation, obstacle, hit);
+
+    // TODO: the triangle, quad & OBB projections are not implemented yet
+    case ShapeType::TRIANGLE:
+    case ShapeType::QUAD:
+    case ShapeType::OBB:
+      return advanceSphere(sphere.getCenter(), sphere.getRadius(), translation, obstacle.computeBoundingBox(), hit);
+
+    default:
+      break;
+  }
+
+  throw std::invalid_argument("Error: Unhandled shape type in the swept sphere's time of impact computation");
+}
+
+bool computeTimeOfImpact(const AABB& box, const Vec3f& translation, const Shape& obstacle, SweepHit* hit) {
+  if (translation == Vec3f(0.f))
+    return false;
+
+  switch (obstacle.getType()) {
+    case ShapeType::PLANE:
+    {
+      // The box's radius along the plane's normal is the projection of its half extents onto it
+      const auto& plane       = static_cast<const Plane&>(obstacle);
+      const Vec3f halfExtents = box.computeHalfExtents();
+      const float radius      = std::abs(plane.getNormal().x()) * halfExtents.x()
+                              + std::abs(plane.getNormal().y()) * halfExtents.y()
+                              + std::abs(plane.getNormal().z()) * halfExtents.z();
+
+      return sweepAgainstPlane(box.computeCentroid(), radius, translation, plane, hit);
+    }
+
+    case ShapeType::SPHERE:
+    {
+      // The box moving towards the sphere is equivalent to the sphere moving towards the box in the opposite direction
+      const auto& sphere = static_cast<const Sphere&>(obstacle);
+
+      if (!advanceSphere(sphere.getCenter(), sphere.getRadius(), -translation, box, hit))
+        return false;
+
+      if (hit)
+        hit->normal = -hit->normal;
+
+      return true;
+    }
+
+    case ShapeType::AABB:
+      return sweepBoxAgainstBox(box, translation, static_cast<const AABB&>(obstacle), hit);
+
+    case ShapeType::LINE:
+    case ShapeType::TRIANGLE:
+    case ShapeType::QUAD:
+    case ShapeType::OBB:
+      return sweepBoxAgainstBox(box, translation, obstacle.computeBoundingBox(), hit);
+
+    default:
+      break;
+  }
+
+  throw std::invalid_argument("Error: Unhandled shape type in the swept box's time of impact computation");
+}
+
+} // namespace Raz::ShapeSweep
@@ -0,0 +1,161 @@
+#include "RaZ/Physics/SweepAndPrune.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Raz {
+
+void SweepAndPrune::setProxy(std::size_t proxyId, const AABB& box, uint32_t category, uint32_t mask) {
+  if (proxyId >= m_proxies.size())
+    m_proxies.resize(proxyId + 1);
+
+  Proxy& proxy = m_proxies[proxyId];
+
+  if (!proxy.isValid) {
+    // The new proxy is put at the end of the list; it will be moved to its actual position on the next sort
+    m_sortedProxies.emplace_back(proxyId);
+    proxy.isValid = true;
+  }
+
+  proxy.minPos     = box.getLeftBottomBackPos();
+  proxy.maxPos     = box.getRightTopFrontPos();
+  proxy.category   = category;
+  proxy.mask       = mask;
+  proxy.lastUpdate = m_computationIndex;
+}
+
+void SweepAndPrune::removeProxy(std::size_t proxyId) {
+  if (!hasProxy(proxyId))
+    return;
+
+  m_proxies[proxyId].isValid = false;
+  m_sortedProxies.erase(std::find(m_sortedProxies.begin(), m_sortedProxies.end(), proxyId));
+}
+
+const std::vector<SweepAndPrune::ProxyPair>& SweepAndPrune::computeOverlappingPairs() {
+  m_overlappingPairs.clear();
+
+  // Removing the proxies that have not been updated since the last computation
+  const auto staleIter = std::remove_if(m_sortedProxies.begin(), m_sortedProxies.end(), [this] (std::size_t proxyId) {
+    Proxy& proxy = m_proxies[proxyId];
+
+    if (proxy.lastUpdate == m_computationIndex)
+      return false;
+
+    proxy.isValid = false;
+    return true;
+  });
+  m_sortedProxies.erase(staleIter, m_sortedProxies.end());
+
+  ++m_computationIndex;
+
+  sortProxies();
+
+  const std::size_t secondAxis = (m_sweepAxis + 1) % 3;
+  const std::size_t thirdAxis  = (m_sweepAxis + 2) % 3;
+
+  Vec3f centerSum;
+  Vec3f centerSqSum;
+  std::size_t finiteCenterCount = 0;
+
+  m_activeProxies.clear();
+
+  for (const std::size_t proxyId : m_sortedProxies) {
+    const Proxy& proxy = m_proxies[proxyId];
+
+    // Removing the active proxies ending before the current one starts; these can't overlap any of the next ones
+    for (std::size_t activeIndex = 0; activeIndex < m_activeProxies.size();) {
+      if (m_proxies[m_activeProxies[activeIndex]].maxPos[m_sweepAxis] >= proxy.minPos[m_sweepAxis]) {
+        ++activeIndex;
+        continue;
+      }
+
+      m_activeProxies[activeIndex] = m_activeProxies.back();
+      m_activeProxies.pop_back();
+    }
+
+    // All remaining active proxies overlap the current one along the sweep axis; only the two other axes must be checked
+    for (const std::size_t activeProxyId : m_activeProxies) {
+      const Proxy& activeProxy = m_proxies[activeProxyId];
+
+      if ((proxy.category & activeProxy.mask) == 0 || (activeProxy.category & proxy.mask) == 0)
+        continue;
+
+      if (proxy.minPos[secondAxis] > activeProxy.maxPos[secondAxis] || proxy.maxPos[secondAxis] < activeProxy.minPos[secondAxis]
+       || proxy.minPos[thirdAxis] > activeProxy.maxPos[thirdAxis] || proxy.maxPos[thirdAxis] < activeProxy.minPos[thirdAxis])
+        continue;
+
+      m_overlappingPairs.emplace_back(std::min(proxyId, activeProxyId), std::max(proxyId, activeProxyId));
+    }
+
+    m_activeProxies.emplace_back(proxyId);
+
+    // Infinite boxes (such as planes') are left out of the spread computation, which would otherwise be meaningless
+    const Vec3f center = (proxy.minPos + proxy.maxPos) * 0.5f;
+
+    if (std::isfinite(center.x()) && std::isfinite(center.y()) && std::isfinite(center.z())) {
+      centerSum   += center;
+      centerSqSum += center * center;
+      ++finiteCenterCount;
+    }
+  }
+
+  std::sort(m_overlappingPairs.begin(), m_overlappingPairs.end());
+
+  if (finiteCenterCount == 0)
+    return m_overlappingPairs;
+
+  // The next sweep will be made along the axis on which the boxes are the most spread out, since it is the one on which the
+  //  fewest overlaps are to be expected
+  const float invCount   = 1.f / static_cast<float>(finiteCenterCount);
+  const Vec3f centerMean = centerSum * invCount;
+  const Vec3f variance   = centerSqSum * invCount - centerMean * centerMean;
+
+  std::size_t bestAxis = m_sweepAxis;
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    if (variance[axis] > variance[bestAxis])
+      bestAxis = axis;
+  }
+
+  if (bestAxis != m_sweepAxis) {
+    m_sweepAxis        = bestAxis;
+    m_isFullSortNeeded = true;
+  }
+
+  return m_overlappingPairs;
+}
+
+void SweepAndPrune::clear() noexcept {
+  m_proxies.clear();
+  m_sortedProxies.clear();
+  m_activeProxies.clear();
+  m_overlappingPairs.clear();
+  m_isFullSortNeeded = false;
+}
+
+void SweepAndPrune::sortProxies() {
+  const auto isLower = [this] (std::size_t firstProxyId, std::size_t secondProxyId) {
+    return (m_proxies[firstProxyId].minPos[m_sweepAxis] < m_proxies[secondProxyId].minPos[m_sweepAxis]);
+  };
+
+  if (m_isFullSortNeeded) {
+    std::sort(m_sortedProxies.begin(), m_sortedProxies.end(), isLower);
+    m_isFullSortNeeded = false;
+    return;
+  }
+
+  // The proxies are expected to be nearly sorted from the previous computation, for which an insertion sort is well suited
+  for (std::size_t sortedIndex = 1; sortedIndex < m_sortedProxies.size(); ++sortedIndex) {
+    const std::size_t proxyId = m_sortedProxies[sortedIndex];
+    std::size_t insertIndex   = sortedIndex;
+
+    for (; insertIndex > 0 && isLower(proxyId, m_sortedProxies[insertIndex - 1]); --insertIndex)
+      m_sortedProxies[insertIndex] = m_sortedProxies[insertIndex - 1];
+
+    m_sortedProxies[insertIndex] = proxyId;
+  }
+}
+
+} // namespace Raz
@@ -2,6 +2,8 @@
 #include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/World.hpp"
 
 namespace Raz {
 
@@ -32,7 +34,10 @@ void RenderGraph::updateShaders() const {
 }
 
 void RenderGraph::execute(RenderSystem& renderSystem) const {
+  RAZ_PROFILE_ZONE("RenderGraph::execute");
+
   assert("Error: The render system needs a camera for the render graph to be executed." && (renderSystem.m_cameraEntity != nullptr));
+  assert("Error: The render system must belong to a world for the render graph to be executed." && (renderSystem.m_world != nullptr));
 
   m_geometryPass.getProgram().use();
 
@@ -66,19 +71,15 @@ void RenderGraph::execute(RenderSystem& renderSystem) const {
     viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
   }
 
-  for (const Entity* entity : renderSystem.m_entities) {
-    if (entity->isEnabled()) {
-      if (entity->hasComponent<Mesh>() && entity->hasComponent<Transform>()) {
-        const Mat4f modelMat = entity->getComponent<Transform>().computeTransformMatrix();
+  const ShaderProgram& geometryProgram = m_geometryPass.getProgram();
 
-        const ShaderProgram& geometryProgram = m_geometryPass.getProgram();
+  for (auto [mesh, transform] : renderSystem.m_world->view<Mesh, Transform>()) {
+    const Mat4f& modelMat = transform.getWorldMatrix();
 
-        geometryProgram.sendUniform("uniModelMatrix", modelMat);
-        geometryProgram.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
+    geometryProgram.sendUniform("uniModelMatrix", modelMat);
+    geometryProgram.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
 
-        entity->getComponent<Mesh>().draw(geometryProgram);
-      }
-    }
+    mesh.draw(geometryProgram);
   }
 
   if (renderSystem.hasCubemap())
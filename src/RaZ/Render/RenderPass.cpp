@@ -1,4 +1,5 @@
 #include "RaZ/Render/RenderPass.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 namespace Raz {
 
@@ -44,6 +45,8 @@ void RenderPass::addReadTexture(const Texture& texture, const std::string& unifo
 }
 
 void RenderPass::execute(const Framebuffer& prevFramebuffer) const {
+  RAZ_PROFILE_ZONE("RenderPass::execute");
+
   if (m_enabled) {
     for (const Texture* texture : m_readTextures) {
       texture->activate();
@@ -2,26 +2,30 @@
 
 namespace Raz {
 
-bool System::containsEntity(const EntityPtr& entity) {
-  for (const Entity* entityPtr : m_entities) {
-    if (entityPtr->getId() == entity->getId())
-      return true;
-  }
-
-  return false;
+bool System::containsEntity(const EntityPtr& entity) const noexcept {
+  return (entity->getId() < m_entityPositions.size() && m_entityPositions[entity->getId()] != InvalidPosition);
 }
 
 void System::linkEntity(const EntityPtr& entity) {
+  if (entity->getId() >= m_entityPositions.size())
+    m_entityPositions.resize(entity->getId() + 1, InvalidPosition);
+
+  m_entityPositions[entity->getId()] = m_entities.size();
   m_entities.emplace_back(entity.get());
 }
 
 void System::unlinkEntity(const EntityPtr& entity) {
-  for (std::size_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex) {
-    if (m_entities[entityIndex]->getId() == entity->getId()) {
-      m_entities.erase(m_entities.begin() + static_cast<std::ptrdiff_t>(entityIndex));
-      break;
-    }
-  }
+  if (!containsEntity(entity))
+    return;
+
+  // Swapping the entity with the last one, so that the removal is made in constant time
+  const std::size_t entityPos = m_entityPositions[entity->getId()];
+  Entity* lastEntity          = m_entities.back();
+
+  m_entities[entityPos]                  = lastEntity;
+  m_entityPositions[lastEntity->getId()] = entityPos;
+  m_entityPositions[entity->getId()]     = InvalidPosition;
+  m_entities.pop_back();
 }
 
 } // namespace Raz
@@ -0,0 +1,186 @@
+#include "RaZ/SystemGraph.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
+
+namespace Raz {
+
+namespace {
+
+/// State shared by all the systems during a graph's execution.
+struct ExecutionState {
+  const std::function<bool(std::size_t)>& action;
+  std::atomic<std::size_t> completedNodeCount = 0;
+  std::vector<SystemNode*> exclusiveNodes {}; ///< Nodes ready to be executed, which must be on the executing thread.
+  std::exception_ptr exception {};
+  std::mutex mutex {};
+#if defined(RAZ_THREADS_AVAILABLE)
+  Threading::TaskGroup taskGroup {};
+#endif
+};
+
+} // namespace
+
+bool SystemGraph::areConflicting(const System& system1, const System& system2) noexcept {
+  if (!system1.hasDeclaredAccesses() || !system2.hasDeclaredAccesses())
+    return true;
+
+  return (system1.getWriteComponents().intersects(system2.getReadComponents())
+       || system1.getWriteComponents().intersects(system2.getWriteComponents())
+       || system2.getWriteComponents().intersects(system1.getReadComponents()));
+}
+
+void SystemGraph::build(const std::vector<SystemPtr>& systems, const Bitset& activeSystems) {
+  m_nodes.clear();
+  m_criticalPath.clear();
+  m_criticalPathTime = 0.f;
+
+  for (std::size_t systemIndex = 0; systemIndex < systems.size(); ++systemIndex) {
+    if (!systems[systemIndex] || systemIndex >= activeSystems.getSize() || !activeSystems[systemIndex])
+      continue;
+
+    SystemNode& node = addNode(*systems[systemIndex], systemIndex);
+
+    // Each system depends on all the previous ones it conflicts with, so that they keep being executed in the same order
+    for (std::size_t prevNodeIndex = 0; prevNodeIndex < m_nodes.size() - 1; ++prevNodeIndex) {
+      SystemNode& prevNode = *m_nodes[prevNodeIndex];
+
+      if (!areConflicting(*prevNode.m_system, *node.m_system))
+        continue;
+
+      prevNode.addChildren(node);
+      ++node.m_parentCount;
+    }
+  }
+}
+
+void SystemGraph::execute(const std::function<bool(std::size_t)>& action) {
+  if (m_nodes.empty())
+    return;
+
+  ExecutionState state { action };
+
+  const std::function<void(SystemNode&)> runNode = [&state, &runNode] (SystemNode& node) {
+    const auto startTime = std::chrono::steady_clock::now();
+
+    try {
+      node.m_isSystemActive = state.action(node.m_systemIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      if (!state.exception)
+        state.exception = std::current_exception();
+    }
+
+    node.m_executionTime = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+
+    // The children must be made ready before the node is marked as completed, otherwise the execution could end prematurely
+    for (SystemNode* child : node.m_children) {
+      if (child->m_remainingParentCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        continue;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+      if (!child->isExclusive()) {
+        state.taskGroup.run([&runNode, child] () { runNode(*child); });
+        continue;
+      }
+#endif
+
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.exclusiveNodes.emplace_back(child);
+    }
+
+    state.completedNodeCount.fetch_add(1, std::memory_order_release);
+  };
+
+  for (const std::unique_ptr<SystemNode>& node : m_nodes)
+    node->m_remainingParentCount.store(node->m_parentCount, std::memory_order_relaxed);
+
+  for (const std::unique_ptr<SystemNode>& node : m_nodes) {
+    if (node->m_parentCount != 0)
+      continue;
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    if (!node->isExclusive()) {
+      SystemNode* rootNode = node.get();
+      state.taskGroup.run([&runNode, rootNode] () { runNode(*rootNode); });
+      continue;
+    }
+#endif
+
+    state.exclusiveNodes.emplace_back(node.get());
+  }
+
+  while (state.completedNodeCount.load(std::memory_order_acquire) < m_nodes.size()) {
+    SystemNode* exclusiveNode = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      if (!state.exclusiveNodes.empty()) {
+        // The nodes are taken in their insertion order, so that exclusive systems ready at the same time keep their relative order
+        exclusiveNode = state.exclusiveNodes.front();
+        state.exclusiveNodes.erase(state.exclusiveNodes.begin());
+      }
+    }
+
+    if (exclusiveNode) {
+      runNode(*exclusiveNode);
+      continue;
+    }
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    // Helping the workers while no system is to be executed on the current thread
+    if (!Threading::getDefaultThreadPool().runPendingTask())
+      std::this_thread::yield();
+#endif
+  }
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  state.taskGroup.wait();
+#endif
+
+  computeCriticalPath();
+
+  if (state.exception)
+    std::rethrow_exception(state.exception);
+}
+
+void SystemGraph::computeCriticalPath() {
+  for (const std::unique_ptr<SystemNode>& node : m_nodes) {
+    node->m_pathTime        = 0.f;
+    node->m_pathPredecessor = nullptr;
+  }
+
+  // Nodes are stored in execution order, children always being placed after their parents; the longest path ending at
+  //   each node can thus be computed in a single pass
+  const SystemNode* lastNode = m_nodes.front().get();
+
+  for (const std::unique_ptr<SystemNode>& node : m_nodes) {
+    node->m_pathTime += node->m_executionTime;
+
+    if (node->m_pathTime > lastNode->m_pathTime)
+      lastNode = node.get();
+
+    for (SystemNode* child : node->m_children) {
+      if (node->m_pathTime < child->m_pathTime)
+        continue;
+
+      child->m_pathTime        = node->m_pathTime;
+      child->m_pathPredecessor = node.get();
+    }
+  }
+
+  m_criticalPathTime = lastNode->m_pathTime;
+  m_criticalPath.clear();
+
+  for (const SystemNode* node = lastNode; node != nullptr; node = node->m_pathPredecessor)
+    m_criticalPath.emplace_back(node);
+
+  std::reverse(m_criticalPath.begin(), m_criticalPath.end());
+}
+
+} // namespace Raz
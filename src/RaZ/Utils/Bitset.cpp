@@ -1,42 +1,107 @@
 #include "RaZ/Utils/Bitset.hpp"
 
+#include <utility>
+
 namespace Raz {
 
+Bitset::Bitset(std::size_t bitCount, bool initVal) {
+  resize(bitCount);
+
+  if (!initVal)
+    return;
+
+  std::fill_n(getWords(), getWordCount(), ~Word(0));
+  clearUnusedBits();
+}
+
+Bitset::Bitset(std::initializer_list<bool> values) {
+  resize(values.size());
+
+  std::size_t bitIndex = 0;
+
+  for (const bool value : values) {
+    if (value)
+      setBit(bitIndex);
+
+    ++bitIndex;
+  }
+}
+
+Bitset::Bitset(Bitset&& bitset) noexcept
+  : m_bitCount{ std::exchange(bitset.m_bitCount, 0) },
+    m_inlineWords{ std::exchange(bitset.m_inlineWords, {}) },
+    m_heapWords{ std::move(bitset.m_heapWords) } {}
+
 void Bitset::setBit(std::size_t position, bool value) {
-  if (position >= m_bits.size())
-    m_bits.resize(position + 1);
+  if (position >= m_bitCount)
+    resize(position + 1);
 
-  m_bits[position] = value;
+  Word& word      = getWords()[position / WordBitCount];
+  const Word mask = Word(1) << (position % WordBitCount);
+
+  if (value)
+    word |= mask;
+  else
+    word &= ~mask;
+}
+
+void Bitset::resize(std::size_t newSize) {
+  const std::size_t newWordCount = computeWordCount(newSize);
+
+  if (newSize > InlineBitCount) {
+    // Moving the bits to the heap if they were stored inline
+    if (m_bitCount <= InlineBitCount) {
+      m_heapWords.assign(m_inlineWords.cbegin(), m_inlineWords.cend());
+      m_inlineWords.fill(0);
+    }
+
+    m_heapWords.resize(newWordCount, 0);
+  } else if (m_bitCount > InlineBitCount) {
+    // Moving the remaining bits back inline
+    std::copy_n(m_heapWords.cbegin(), newWordCount, m_inlineWords.begin());
+    m_heapWords.clear();
+  }
+
+  m_bitCount = newSize;
+  clearUnusedBits();
+}
+
+void Bitset::clear() noexcept {
+  m_bitCount = 0;
+  m_inlineWords.fill(0);
+  m_heapWords.clear();
 }
 
 Bitset Bitset::operator~() const noexcept {
   Bitset res = *this;
+  Word* resWords = res.getWords();
 
-  for (auto bit : res.getBits())
-    bit = !bit;
+  for (std::size_t wordIndex = 0; wordIndex < res.getWordCount(); ++wordIndex)
+    resWords[wordIndex] = ~resWords[wordIndex];
 
+  res.clearUnusedBits();
   return res;
 }
 
 Bitset Bitset::operator&(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res &= bitset;
   return res;
 }
 
 Bitset Bitset::operator|(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res |= bitset;
   return res;
 }
 
 Bitset Bitset::operator^(const Bitset& bitset) const noexcept {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + static_cast<std::ptrdiff_t>(res.getSize()), res.getBits().begin());
+  Bitset res = *this;
+  res.resize(std::min(m_bitCount, bitset.getSize()));
 
   res ^= bitset;
   return res;
@@ -55,33 +120,84 @@ Bitset Bitset::operator>>(std::size_t shift) const {
 }
 
 Bitset& Bitset::operator&=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] & bitset[bitIndex];
+  Word* words            = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < std::min(getWordCount(), bitset.getWordCount()); ++wordIndex) {
+    Word otherWord = otherWords[wordIndex];
+
+    // The bits past the given bitset's size must be left untouched
+    if ((wordIndex + 1) * WordBitCount > bitset.getSize())
+      otherWord |= ~Word(0) << (bitset.getSize() % WordBitCount);
+
+    words[wordIndex] &= otherWord;
+  }
+
   return *this;
 }
 
 Bitset& Bitset::operator|=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] | bitset[bitIndex];
+  Word* words            = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  // The given bitset's words having no bit enabled past its size, the corresponding bits remain untouched
+  for (std::size_t wordIndex = 0; wordIndex < std::min(getWordCount(), bitset.getWordCount()); ++wordIndex)
+    words[wordIndex] |= otherWords[wordIndex];
+
+  clearUnusedBits();
   return *this;
 }
 
 Bitset& Bitset::operator^=(const Bitset& bitset) noexcept {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] ^ bitset[bitIndex];
+  Word* words            = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < std::min(getWordCount(), bitset.getWordCount()); ++wordIndex)
+    words[wordIndex] ^= otherWords[wordIndex];
+
+  clearUnusedBits();
   return *this;
 }
 
 Bitset& Bitset::operator<<=(std::size_t shift) {
-  m_bits.resize(m_bits.size() + shift);
+  resize(m_bitCount + shift);
   return *this;
 }
 
 Bitset& Bitset::operator>>=(std::size_t shift) {
-  m_bits.resize(m_bits.size() - shift);
+  resize(m_bitCount - shift);
   return *this;
 }
 
+Bitset& Bitset::operator=(Bitset&& bitset) noexcept {
+  m_bitCount    = std::exchange(bitset.m_bitCount, 0);
+  m_inlineWords = std::exchange(bitset.m_inlineWords, {});
+  m_heapWords   = std::move(bitset.m_heapWords);
+
+  return *this;
+}
+
+bool Bitset::operator==(const Bitset& bitset) const noexcept {
+  if (bitset.getSize() < m_bitCount)
+    return false;
+
+  const Word* words      = getWords();
+  const Word* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex) {
+    Word otherWord = otherWords[wordIndex];
+
+    // Only the bits up to this bitset's size are compared
+    if ((wordIndex + 1) * WordBitCount > m_bitCount)
+      otherWord &= ~(~Word(0) << (m_bitCount % WordBitCount));
+
+    if (words[wordIndex] != otherWord)
+      return false;
+  }
+
+  return true;
+}
+
 std::ostream& operator<<(std::ostream& stream, const Bitset& bitset) {
   stream << "[ " << bitset[0];
 
@@ -93,4 +209,15 @@ std::ostream& operator<<(std::ostream& stream, const Bitset& bitset) {
   return stream;
 }
 
+void Bitset::clearUnusedBits() noexcept {
+  Word* words = getWords();
+
+  // Clearing the whole inline words which are not used anymore
+  if (m_bitCount <= InlineBitCount)
+    std::fill(m_inlineWords.begin() + static_cast<std::ptrdiff_t>(getWordCount()), m_inlineWords.end(), 0);
+
+  if (m_bitCount % WordBitCount != 0)
+    words[getWordCount() - 1] &= ~(~Word(0) << (m_bitCount % WordBitCount));
+}
+
 } // namespace Raz
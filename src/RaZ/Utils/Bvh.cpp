@@ -0,0 +1,538 @@
+#include "RaZ/Utils/Bvh.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t SahBinCount = 12; ///< Number of candidate split positions tested on each axis when building.
+
+float computeSurfaceArea(const Vec3f& minPos, const Vec3f& maxPos) noexcept {
+  const Vec3f extents = maxPos - minPos;
+  return 2.f * (extents.x() * extents.y() + extents.y() * extents.z() + extents.z() * extents.x());
+}
+
+float computeSurfaceArea(const AABB& box) noexcept {
+  return computeSurfaceArea(box.getLeftBottomBackPos(), box.getRightTopFrontPos());
+}
+
+void expand(Vec3f& minPos, Vec3f& maxPos, const Vec3f& otherMinPos, const Vec3f& otherMaxPos) noexcept {
+  for (std::size_t i = 0; i < 3; ++i) {
+    minPos[i] = std::min(minPos[i], otherMinPos[i]);
+    maxPos[i] = std::max(maxPos[i], otherMaxPos[i]);
+  }
+}
+
+AABB computeUnion(const AABB& firstBox, const AABB& secondBox) noexcept {
+  Vec3f minPos = firstBox.getLeftBottomBackPos();
+  Vec3f maxPos = firstBox.getRightTopFrontPos();
+  expand(minPos, maxPos, secondBox.getLeftBottomBackPos(), secondBox.getRightTopFrontPos());
+
+  return AABB(minPos, maxPos);
+}
+
+} // namespace
+
+const AABB& Bvh::getBoundingBox() const noexcept {
+  assert("Error: An empty BVH has no bounding box." && m_rootIndex != InvalidIndex);
+  return m_nodes[m_rootIndex].box;
+}
+
+const AABB& Bvh::getPrimitiveBox(std::size_t primitiveId) const noexcept {
+  assert("Error: The requested BVH primitive does not exist." && contains(primitiveId));
+  return m_nodes[m_primitives[primitiveId].leafIndex].box;
+}
+
+std::size_t Bvh::insert(const AABB& box) {
+  return insertPrimitive(Primitive(), box);
+}
+
+std::size_t Bvh::insert(const Triangle& triangle) {
+  Primitive primitive;
+  primitive.shape = triangle;
+
+  return insertPrimitive(std::move(primitive), triangle.computeBoundingBox());
+}
+
+std::size_t Bvh::insert(const Shape& shape) {
+  Primitive primitive;
+  primitive.shape = &shape;
+
+  return insertPrimitive(std::move(primitive), shape.computeBoundingBox());
+}
+
+void Bvh::remove(std::size_t primitiveId) {
+  assert("Error: The BVH primitive to be removed does not exist." && contains(primitiveId));
+
+  const std::size_t leafIndex = m_primitives[primitiveId].leafIndex;
+  removeLeaf(leafIndex);
+  freeNode(leafIndex);
+
+  m_primitives[primitiveId] = Primitive();
+  m_freePrimitiveIds.emplace_back(primitiveId);
+  --m_primitiveCount;
+}
+
+void Bvh::update(std::size_t primitiveId, const AABB& box) {
+  assert("Error: The BVH primitive to be updated does not exist." && contains(primitiveId));
+  assert("Error: Only box primitives can be given a new box." && std::holds_alternative<std::monostate>(m_primitives[primitiveId].shape));
+
+  const std::size_t leafIndex = m_primitives[primitiveId].leafIndex;
+
+  m_nodes[leafIndex].box = box;
+  refitAncestors(leafIndex);
+}
+
+void Bvh::update(std::size_t primitiveId) {
+  assert("Error: The BVH primitive to be updated does not exist." && contains(primitiveId));
+
+  const Primitive& primitive = m_primitives[primitiveId];
+
+  if (const auto* triangle = std::get_if<Triangle>(&primitive.shape))
+    m_nodes[primitive.leafIndex].box = triangle->computeBoundingBox();
+  else if (const auto* shape = std::get_if<const Shape*>(&primitive.shape))
+    m_nodes[primitive.leafIndex].box = (*shape)->computeBoundingBox();
+  else
+    return;
+
+  refitAncestors(primitive.leafIndex);
+}
+
+void Bvh::refit() {
+  if (m_rootIndex == InvalidIndex)
+    return;
+
+  // Listing the nodes so that each one is placed before its children; iterating in reverse thus processes children first
+  std::vector<std::size_t> nodeIndices;
+  nodeIndices.reserve(m_nodes.size() - m_freeNodeIndices.size());
+  nodeIndices.emplace_back(m_rootIndex);
+
+  for (std::size_t i = 0; i < nodeIndices.size(); ++i) {
+    const Node& node = m_nodes[nodeIndices[i]];
+
+    if (node.isLeaf())
+      continue;
+
+    nodeIndices.emplace_back(node.firstChildIndex);
+    nodeIndices.emplace_back(node.secondChildIndex);
+  }
+
+  for (auto nodeIndexIter = nodeIndices.crbegin(); nodeIndexIter != nodeIndices.crend(); ++nodeIndexIter) {
+    Node& node = m_nodes[*nodeIndexIter];
+
+    if (!node.isLeaf()) {
+      node.box = computeUnion(m_nodes[node.firstChildIndex].box, m_nodes[node.secondChildIndex].box);
+      continue;
+    }
+
+    const Primitive& primitive = m_primitives[node.primitiveId];
+
+    if (const auto* triangle = std::get_if<Triangle>(&primitive.shape))
+      node.box = triangle->computeBoundingBox();
+    else if (const auto* shape = std::get_if<const Shape*>(&primitive.shape))
+      node.box = (*shape)->computeBoundingBox();
+  }
+}
+
+void Bvh::build() {
+  if (m_rootIndex == InvalidIndex)
+    return;
+
+  refit();
+
+  // Only the leaves are kept, packed at the beginning of the node list; all the parent nodes are then recreated
+  std::vector<Node> leaves;
+  leaves.reserve(m_primitiveCount);
+
+  for (std::size_t primitiveId = 0; primitiveId < m_primitives.size(); ++primitiveId) {
+    Primitive& primitive = m_primitives[primitiveId];
+
+    if (primitive.leafIndex == InvalidIndex)
+      continue;
+
+    leaves.emplace_back(std::move(m_nodes[primitive.leafIndex]));
+    primitive.leafIndex = leaves.size() - 1;
+  }
+
+  m_nodes = std::move(leaves);
+  m_nodes.reserve(m_nodes.size() * 2 - 1);
+  m_freeNodeIndices.clear();
+
+  std::vector<std::size_t> leafIndices(m_nodes.size());
+  std::vector<Vec3f> centroids(m_nodes.size());
+
+  for (std::size_t leafIndex = 0; leafIndex < m_nodes.size(); ++leafIndex) {
+    leafIndices[leafIndex] = leafIndex;
+    centroids[leafIndex]   = m_nodes[leafIndex].box.computeCentroid();
+  }
+
+  m_rootIndex = buildSubtree(leafIndices, centroids, 0, leafIndices.size());
+  m_nodes[m_rootIndex].parentIndex = InvalidIndex;
+}
+
+void Bvh::clear() noexcept {
+  m_primitives.clear();
+  m_freePrimitiveIds.clear();
+  m_primitiveCount = 0;
+  m_nodes.clear();
+  m_freeNodeIndices.clear();
+  m_rootIndex = InvalidIndex;
+}
+
+bool Bvh::castClosest(const Ray& ray, BvhHit* hit, float maxDistance) const {
+  BvhHit closestHit;
+  closestHit.rayHit.distance = maxDistance;
+
+  traverse(ray, [this, &ray, &closestHit] (std::size_t primitiveId, float& maxDist) {
+    RayHit primitiveHit;
+
+    if (intersectsPrimitive(ray, primitiveId, primitiveHit) && primitiveHit.distance <= maxDist) {
+      closestHit.primitiveId = primitiveId;
+      closestHit.rayHit      = primitiveHit;
+      maxDist                = primitiveHit.distance;
+    }
+
+    return true;
+  }, maxDistance);
+
+  if (closestHit.primitiveId == InvalidId)
+    return false;
+
+  if (hit)
+    *hit = closestHit;
+
+  return true;
+}
+
+bool Bvh::castAny(const Ray& ray, BvhHit* hit, float maxDistance) const {
+  BvhHit foundHit;
+
+  traverse(ray, [this, &ray, &foundHit] (std::size_t primitiveId, float& maxDist) {
+    RayHit primitiveHit;
+
+    if (!intersectsPrimitive(ray, primitiveId, primitiveHit) || primitiveHit.distance > maxDist)
+      return true;
+
+    foundHit.primitiveId = primitiveId;
+    foundHit.rayHit      = primitiveHit;
+    return false;
+  }, maxDistance);
+
+  if (foundHit.primitiveId == InvalidId)
+    return false;
+
+  if (hit)
+    *hit = foundHit;
+
+  return true;
+}
+
+std::vector<BvhHit> Bvh::castAll(const Ray& ray, float maxDistance) const {
+  std::vector<BvhHit> hits;
+
+  traverse(ray, [this, &ray, &hits] (std::size_t primitiveId, float& maxDist) {
+    RayHit primitiveHit;
+
+    if (intersectsPrimitive(ray, primitiveId, primitiveHit) && primitiveHit.distance <= maxDist)
+      hits.push_back(BvhHit{ primitiveId, primitiveHit });
+
+    return true;
+  }, maxDistance);
+
+  std::sort(hits.begin(), hits.end(), [] (const BvhHit& firstHit, const BvhHit& secondHit) {
+    return (firstHit.rayHit.distance < secondHit.rayHit.distance);
+  });
+
+  return hits;
+}
+
+std::vector<std::size_t> Bvh::queryOverlaps(const AABB& box) const {
+  std::vector<std::size_t> primitiveIds;
+
+  if (m_rootIndex == InvalidIndex)
+    return primitiveIds;
+
+  std::vector<std::size_t> nodeIndices;
+  nodeIndices.emplace_back(m_rootIndex);
+
+  while (!nodeIndices.empty()) {
+    const Node& node = m_nodes[nodeIndices.back()];
+    nodeIndices.pop_back();
+
+    if (!node.box.intersects(box))
+      continue;
+
+    if (node.isLeaf()) {
+      primitiveIds.emplace_back(node.primitiveId);
+      continue;
+    }
+
+    nodeIndices.emplace_back(node.firstChildIndex);
+    nodeIndices.emplace_back(node.secondChildIndex);
+  }
+
+  return primitiveIds;
+}
+
+std::size_t Bvh::insertPrimitive(Primitive&& primitive, const AABB& box) {
+  std::size_t primitiveId {};
+
+  if (m_freePrimitiveIds.empty()) {
+    primitiveId = m_primitives.size();
+    m_primitives.emplace_back(std::move(primitive));
+  } else {
+    primitiveId = m_freePrimitiveIds.back();
+    m_freePrimitiveIds.pop_back();
+    m_primitives[primitiveId] = std::move(primitive);
+  }
+
+  const std::size_t leafIndex = allocateNode();
+
+  Node& leaf       = m_nodes[leafIndex];
+  leaf.box         = box;
+  leaf.primitiveId = primitiveId;
+
+  m_primitives[primitiveId].leafIndex = leafIndex;
+  ++m_primitiveCount;
+
+  insertLeaf(leafIndex);
+
+  return primitiveId;
+}
+
+std::size_t Bvh::allocateNode() {
+  if (m_freeNodeIndices.empty()) {
+    m_nodes.emplace_back();
+    return m_nodes.size() - 1;
+  }
+
+  const std::size_t nodeIndex = m_freeNodeIndices.back();
+  m_freeNodeIndices.pop_back();
+
+  m_nodes[nodeIndex] = Node();
+  return nodeIndex;
+}
+
+void Bvh::freeNode(std::size_t nodeIndex) {
+  m_nodes[nodeIndex].primitiveId = InvalidId;
+  m_freeNodeIndices.emplace_back(nodeIndex);
+}
+
+void Bvh::insertLeaf(std::size_t leafIndex) {
+  if (m_rootIndex == InvalidIndex) {
+    m_rootIndex = leafIndex;
+    m_nodes[leafIndex].parentIndex = InvalidIndex;
+    return;
+  }
+
+  const AABB leafBox = m_nodes[leafIndex].box;
+
+  // Descending the tree to find the best sibling for the new leaf: at each level, either the current node becomes the
+  //  sibling, or the leaf goes down into the child whose area would increase the least
+  // See: https://box2d.org/files/ErinCatto_DynamicBVH_Full.pdf
+  const auto computeDescentCost = [this, &leafBox] (std::size_t childIndex) {
+    const Node& child     = m_nodes[childIndex];
+    const float unionArea = computeSurfaceArea(computeUnion(child.box, leafBox));
+    return (child.isLeaf() ? unionArea : unionArea - computeSurfaceArea(child.box));
+  };
+
+  std::size_t siblingIndex = m_rootIndex;
+
+  while (!m_nodes[siblingIndex].isLeaf()) {
+    const Node& node = m_nodes[siblingIndex];
+
+    const float nodeArea  = computeSurfaceArea(node.box);
+    const float unionArea = computeSurfaceArea(computeUnion(node.box, leafBox));
+
+    // Cost of making this node the leaf's sibling, & minimum cost added to all the ancestors if going further down
+    const float siblingCost     = 2.f * unionArea;
+    const float inheritanceCost = 2.f * (unionArea - nodeArea);
+
+    const float firstChildCost  = computeDescentCost(node.firstChildIndex) + inheritanceCost;
+    const float secondChildCost = computeDescentCost(node.secondChildIndex) + inheritanceCost;
+
+    if (siblingCost < firstChildCost && siblingCost < secondChildCost)
+      break;
+
+    siblingIndex = (firstChildCost < secondChildCost ? node.firstChildIndex : node.secondChildIndex);
+  }
+
+  const std::size_t oldParentIndex = m_nodes[siblingIndex].parentIndex;
+  const std::size_t newParentIndex = allocateNode();
+
+  Node& newParent            = m_nodes[newParentIndex];
+  newParent.box              = computeUnion(m_nodes[siblingIndex].box, leafBox);
+  newParent.parentIndex      = oldParentIndex;
+  newParent.firstChildIndex  = siblingIndex;
+  newParent.secondChildIndex = leafIndex;
+
+  m_nodes[siblingIndex].parentIndex = newParentIndex;
+  m_nodes[leafIndex].parentIndex    = newParentIndex;
+
+  if (oldParentIndex == InvalidIndex) {
+    m_rootIndex = newParentIndex;
+    return;
+  }
+
+  Node& oldParent = m_nodes[oldParentIndex];
+  (oldParent.firstChildIndex == siblingIndex ? oldParent.firstChildIndex : oldParent.secondChildIndex) = newParentIndex;
+
+  refitAncestors(newParentIndex);
+}
+
+void Bvh::removeLeaf(std::size_t leafIndex) {
+  if (leafIndex == m_rootIndex) {
+    m_rootIndex = InvalidIndex;
+    return;
+  }
+
+  // The leaf's parent is removed as well, its other child taking its place
+  const std::size_t parentIndex      = m_nodes[leafIndex].parentIndex;
+  const Node& parent                 = m_nodes[parentIndex];
+  const std::size_t siblingIndex     = (parent.firstChildIndex == leafIndex ? parent.secondChildIndex : parent.firstChildIndex);
+  const std::size_t grandParentIndex = parent.parentIndex;
+
+  m_nodes[siblingIndex].parentIndex = grandParentIndex;
+
+  if (grandParentIndex == InvalidIndex) {
+    m_rootIndex = siblingIndex;
+  } else {
+    Node& grandParent = m_nodes[grandParentIndex];
+    (grandParent.firstChildIndex == parentIndex ? grandParent.firstChildIndex : grandParent.secondChildIndex) = siblingIndex;
+
+    refitAncestors(siblingIndex);
+  }
+
+  freeNode(parentIndex);
+}
+
+void Bvh::refitAncestors(std::size_t nodeIndex) {
+  for (std::size_t parentIndex = m_nodes[nodeIndex].parentIndex; parentIndex != InvalidIndex; parentIndex = m_nodes[parentIndex].parentIndex) {
+    Node& parent = m_nodes[parentIndex];
+    parent.box   = computeUnion(m_nodes[parent.firstChildIndex].box, m_nodes[parent.secondChildIndex].box);
+  }
+}
+
+std::size_t Bvh::buildSubtree(std::vector<std::size_t>& leafIndices, const std::vector<Vec3f>& centroids, std::size_t begin, std::size_t end) {
+  if (end - begin == 1)
+    return leafIndices[begin];
+
+  Vec3f minCentroid(std::numeric_limits<float>::max());
+  Vec3f maxCentroid(std::numeric_limits<float>::lowest());
+
+  for (std::size_t i = begin; i < end; ++i) {
+    const Vec3f& centroid = centroids[leafIndices[i]];
+    expand(minCentroid, maxCentroid, centroid, centroid);
+  }
+
+  // Binning the leaves by centroid along each axis, & finding the split between two bins minimizing the SAH cost:
+  //  cost = leftArea * leftCount + rightArea * rightCount
+  float bestCost        = std::numeric_limits<float>::max();
+  std::size_t bestAxis  = 0;
+  std::size_t bestSplit = 0;
+
+  const auto computeBinIndex = [&centroids, &minCentroid, &maxCentroid] (std::size_t leafIndex, std::size_t axis) {
+    const float relativePos = (centroids[leafIndex][axis] - minCentroid[axis]) / (maxCentroid[axis] - minCentroid[axis]);
+    return std::min(static_cast<std::size_t>(relativePos * SahBinCount), SahBinCount - 1);
+  };
+
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    if (maxCentroid[axis] <= minCentroid[axis])
+      continue;
+
+    std::array<Vec3f, SahBinCount> binMinPos;
+    std::array<Vec3f, SahBinCount> binMaxPos;
+    std::array<std::size_t, SahBinCount> binCounts {};
+
+    binMinPos.fill(Vec3f(std::numeric_limits<float>::max()));
+    binMaxPos.fill(Vec3f(std::numeric_limits<float>::lowest()));
+
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::size_t binIndex = computeBinIndex(leafIndices[i], axis);
+      const AABB& leafBox        = m_nodes[leafIndices[i]].box;
+
+      expand(binMinPos[binIndex], binMaxPos[binIndex], leafBox.getLeftBottomBackPos(), leafBox.getRightTopFrontPos());
+      ++binCounts[binIndex];
+    }
+
+    // Accumulating the bins from the right, so that each split's cost can then be computed in a single pass from the left
+    std::array<float, SahBinCount> rightAreas {};
+    std::array<std::size_t, SahBinCount> rightCounts {};
+
+    Vec3f accumMinPos(std::numeric_limits<float>::max());
+    Vec3f accumMaxPos(std::numeric_limits<float>::lowest());
+    std::size_t accumCount = 0;
+
+    for (std::size_t binIndex = SahBinCount - 1; binIndex > 0; --binIndex) {
+      expand(accumMinPos, accumMaxPos, binMinPos[binIndex], binMaxPos[binIndex]);
+      accumCount += binCounts[binIndex];
+
+      rightAreas[binIndex]  = (accumCount > 0 ? computeSurfaceArea(accumMinPos, accumMaxPos) : 0.f);
+      rightCounts[binIndex] = accumCount;
+    }
+
+    accumMinPos = Vec3f(std::numeric_limits<float>::max());
+    accumMaxPos = Vec3f(std::numeric_limits<float>::lowest());
+    accumCount  = 0;
+
+    for (std::size_t binIndex = 0; binIndex < SahBinCount - 1; ++binIndex) {
+      expand(accumMinPos, accumMaxPos, binMinPos[binIndex], binMaxPos[binIndex]);
+      accumCount += binCounts[binIndex];
+
+      if (accumCount == 0 || rightCounts[binIndex + 1] == 0)
+        continue;
+
+      const float cost = computeSurfaceArea(accumMinPos, accumMaxPos) * static_cast<float>(accumCount)
+                       + rightAreas[binIndex + 1] * static_cast<float>(rightCounts[binIndex + 1]);
+
+      if (cost < bestCost) {
+        bestCost  = cost;
+        bestAxis  = axis;
+        bestSplit = binIndex;
+      }
+    }
+  }
+
+  std::size_t middle = begin + (end - begin) / 2;
+
+  // If no split could be found (all the centroids being at the same position), the leaves are simply cut in half
+  if (bestCost < std::numeric_limits<float>::max()) {
+    const auto middleIter = std::partition(leafIndices.begin() + static_cast<std::ptrdiff_t>(begin),
+                                           leafIndices.begin() + static_cast<std::ptrdiff_t>(end),
+                                           [&computeBinIndex, bestAxis, bestSplit] (std::size_t leafIndex) {
+      return (computeBinIndex(leafIndex, bestAxis) <= bestSplit);
+    });
+    middle = static_cast<std::size_t>(middleIter - leafIndices.begin());
+  }
+
+  const std::size_t firstChildIndex  = buildSubtree(leafIndices, centroids, begin, middle);
+  const std::size_t secondChildIndex = buildSubtree(leafIndices, centroids, middle, end);
+  const std::size_t nodeIndex        = allocateNode();
+
+  Node& node            = m_nodes[nodeIndex];
+  node.box              = computeUnion(m_nodes[firstChildIndex].box, m_nodes[secondChildIndex].box);
+  node.firstChildIndex  = firstChildIndex;
+  node.secondChildIndex = secondChildIndex;
+
+  m_nodes[firstChildIndex].parentIndex  = nodeIndex;
+  m_nodes[secondChildIndex].parentIndex = nodeIndex;
+
+  return nodeIndex;
+}
+
+bool Bvh::intersectsPrimitive(const Ray& ray, std::size_t primitiveId, RayHit& hit) const {
+  const Primitive& primitive = m_primitives[primitiveId];
+
+  if (const auto* triangle = std::get_if<Triangle>(&primitive.shape))
+    return ray.intersects(*triangle, &hit);
+
+  if (const auto* shape = std::get_if<const Shape*>(&primitive.shape))
+    return (*shape)->intersects(ray, &hit);
+
+  return ray.intersects(m_nodes[primitive.leafIndex].box, &hit);
+}
+
+} // namespace Raz
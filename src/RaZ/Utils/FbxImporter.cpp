@@ -1,5 +1,6 @@
 #include "RaZ/Render/Mesh.hpp"
 #include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include <fbxsdk.h>
 #include <fstream>
@@ -8,6 +9,8 @@
 namespace Raz {
 
 void Mesh::importFbx(const FilePath& filePath) {
+  RAZ_PROFILE_ZONE("Mesh::importFbx");
+
   FbxManager* manager = FbxManager::Create();
 
   FbxIOSettings* ioSettings = FbxIOSettings::Create(manager, IOSROOT);
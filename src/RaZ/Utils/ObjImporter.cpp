@@ -1,5 +1,6 @@
 #include "RaZ/Render/Mesh.hpp"
 #include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include <fstream>
 #include <map>
@@ -165,6 +166,8 @@ inline void importMtl(const FilePath& mtlFilePath,
 } // namespace
 
 void Mesh::importObj(std::ifstream& file, const FilePath& filePath) {
+  RAZ_PROFILE_ZONE("Mesh::importObj");
+
   std::unordered_map<std::string, std::size_t> materialCorrespIndices;
 
   std::vector<Vec3f> positions;
@@ -1,10 +1,13 @@
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include <fstream>
 
 namespace Raz {
 
 void Mesh::importOff(std::ifstream& file) {
+  RAZ_PROFILE_ZONE("Mesh::importOff");
+
   Submesh& submesh = m_submeshes.front();
 
   std::size_t vertexCount {};
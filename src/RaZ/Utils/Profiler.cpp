@@ -0,0 +1,280 @@
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Raz::Profiler {
+
+/// Zones recorded by a single thread, not collected yet. The buffer is a single-producer/single-consumer ring: the owning thread
+///   is the only one writing to it, & the thread ending the frames the only one reading from it, so that neither has to lock.
+struct ThreadBuffer {
+  static constexpr std::size_t Capacity = 8192; ///< Maximum number of zones recorded between two frames; must be a power of 2.
+
+  explicit ThreadBuffer(uint32_t index) : threadIndex{ index } {}
+
+  std::vector<ZoneEvent> events = std::vector<ZoneEvent>(Capacity);
+  std::atomic<std::size_t> writeIndex = 0;
+  std::atomic<std::size_t> readIndex = 0;
+  uint32_t threadIndex {};
+  uint32_t depth = 0; ///< Number of zones currently entered; only used by the owning thread.
+};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Time spent in a zone during a single frame.
+struct FrameTiming {
+  std::size_t frameIndex {};
+  uint64_t time {};
+  std::size_t callCount {};
+};
+
+/// Timings of a zone over the last frames.
+struct ZoneHistory {
+  std::deque<FrameTiming> frames {};
+  uint64_t currentTime {};
+  std::size_t currentCallCount {};
+};
+
+struct ProfilerState {
+  const Clock::time_point startTime = Clock::now();
+
+  std::mutex threadBuffersMutex {};
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers {};
+
+  std::mutex mutex {}; ///< Guards the members below, accessed by the functions ending frames & fetching the results.
+  std::size_t statsFrameCount = 120;
+  std::size_t frameIndex = 0;
+  std::unordered_map<std::string_view, ZoneHistory> zones {};
+  bool isCapturing = false;
+  std::vector<ZoneEvent> capturedEvents {};
+};
+
+ProfilerState& getState() {
+  // The state is intentionally leaked, since threads may still record zones during the static objects' destruction
+  static ProfilerState& state = *new ProfilerState();
+  return state;
+}
+
+uint64_t getCurrentTime() noexcept {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - getState().startTime).count());
+}
+
+ThreadBuffer& getThreadBuffer() {
+  // The buffer is shared with the state, so that the zones a thread has recorded can still be collected after it has ended
+  thread_local const std::shared_ptr<ThreadBuffer> threadBuffer = [] () {
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.threadBuffersMutex);
+
+    const auto threadIndex = static_cast<uint32_t>(state.threadBuffers.size());
+    return state.threadBuffers.emplace_back(std::make_shared<ThreadBuffer>(threadIndex));
+  }();
+
+  return *threadBuffer;
+}
+
+/// Takes all the zones recorded by the threads since the last collection, calling the given function on each of them.
+template <typename Func>
+void collectEvents(ProfilerState& state, Func&& action) {
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+
+  {
+    std::lock_guard<std::mutex> lock(state.threadBuffersMutex);
+    threadBuffers = state.threadBuffers;
+  }
+
+  for (const std::shared_ptr<ThreadBuffer>& threadBuffer : threadBuffers) {
+    const std::size_t readIndex  = threadBuffer->readIndex.load(std::memory_order_relaxed);
+    const std::size_t writeIndex = threadBuffer->writeIndex.load(std::memory_order_acquire);
+
+    for (std::size_t eventIndex = readIndex; eventIndex < writeIndex; ++eventIndex)
+      action(threadBuffer->events[eventIndex & (ThreadBuffer::Capacity - 1)]);
+
+    threadBuffer->readIndex.store(writeIndex, std::memory_order_release);
+  }
+}
+
+constexpr double toMilliseconds(uint64_t nanoseconds) noexcept {
+  return static_cast<double>(nanoseconds) / 1'000'000.0;
+}
+
+} // namespace
+
+ScopedZone::ScopedZone(const char* name) noexcept : m_name{ name }, m_threadBuffer{ &getThreadBuffer() } {
+  ++m_threadBuffer->depth;
+  m_startTime = getCurrentTime();
+}
+
+ScopedZone::~ScopedZone() {
+  const uint64_t endTime = getCurrentTime();
+  ThreadBuffer& buffer   = *m_threadBuffer;
+
+  --buffer.depth;
+
+  const std::size_t writeIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+
+  // If the buffer is full, frames are not ended often enough; the zone is dropped rather than waiting for the buffer to be read
+  if (writeIndex - buffer.readIndex.load(std::memory_order_acquire) >= ThreadBuffer::Capacity)
+    return;
+
+  buffer.events[writeIndex & (ThreadBuffer::Capacity - 1)] = ZoneEvent{ m_name, m_startTime, endTime - m_startTime, buffer.depth, buffer.threadIndex };
+  buffer.writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+void endFrame() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  collectEvents(state, [&state] (const ZoneEvent& event) {
+    ZoneHistory& zone = state.zones[event.name];
+    zone.currentTime += event.duration;
+    ++zone.currentCallCount;
+
+    if (state.isCapturing)
+      state.capturedEvents.emplace_back(event);
+  });
+
+  for (auto& [name, zone] : state.zones) {
+    if (zone.currentCallCount > 0) {
+      zone.frames.push_back(FrameTiming{ state.frameIndex, zone.currentTime, zone.currentCallCount });
+      zone.currentTime      = 0;
+      zone.currentCallCount = 0;
+    }
+
+    while (!zone.frames.empty() && state.frameIndex - zone.frames.front().frameIndex >= state.statsFrameCount)
+      zone.frames.pop_front();
+  }
+
+  ++state.frameIndex;
+}
+
+void setStatsFrameCount(std::size_t frameCount) {
+  assert("Error: The number of frames the statistics are computed over must be strictly positive." && frameCount > 0);
+
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.statsFrameCount = frameCount;
+}
+
+std::vector<ZoneStats> getZoneStats() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::vector<ZoneStats> zoneStats;
+  zoneStats.reserve(state.zones.size());
+
+  for (const auto& [name, zone] : state.zones) {
+    if (zone.frames.empty())
+      continue;
+
+    ZoneStats& stats = zoneStats.emplace_back();
+    stats.name       = name;
+    stats.frameCount = zone.frames.size();
+
+    uint64_t totalTime = 0;
+    uint64_t minTime   = zone.frames.front().time;
+    uint64_t maxTime   = zone.frames.front().time;
+
+    for (const FrameTiming& frame : zone.frames) {
+      totalTime       += frame.time;
+      minTime          = std::min(minTime, frame.time);
+      maxTime          = std::max(maxTime, frame.time);
+      stats.callCount += frame.callCount;
+    }
+
+    stats.averageTime = toMilliseconds(totalTime) / static_cast<double>(stats.frameCount);
+    stats.minTime     = toMilliseconds(minTime);
+    stats.maxTime     = toMilliseconds(maxTime);
+
+    // The frame index has already been incremented when ending the last frame
+    if (zone.frames.back().frameIndex + 1 == state.frameIndex)
+      stats.lastTime = toMilliseconds(zone.frames.back().time);
+  }
+
+  std::sort(zoneStats.begin(), zoneStats.end(), [] (const ZoneStats& stats1, const ZoneStats& stats2) {
+    return (stats1.averageTime > stats2.averageTime);
+  });
+
+  return zoneStats;
+}
+
+bool isCapturing() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.isCapturing;
+}
+
+void startCapture() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  state.capturedEvents.clear();
+  state.isCapturing = true;
+}
+
+void stopCapture() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.isCapturing = false;
+}
+
+std::vector<ZoneEvent> getCapturedEvents() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.capturedEvents;
+}
+
+void exportChromeTrace(const FilePath& filePath) {
+  std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+
+  if (!file)
+    throw std::invalid_argument("Error: Unable to create a Chrome trace file as '" + filePath + "'; path to file must exist");
+
+  const std::vector<ZoneEvent> events = getCapturedEvents();
+
+  file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+  for (std::size_t eventIndex = 0; eventIndex < events.size(); ++eventIndex) {
+    const ZoneEvent& event = events[eventIndex];
+
+    file << (eventIndex == 0 ? "\n" : ",\n") << "{\"name\":\"";
+
+    for (const char* character = event.name; *character != '\0'; ++character) {
+      if (*character == '"' || *character == '\\')
+        file << '\\';
+      file << *character;
+    }
+
+    // Complete events are used, giving both their start time & duration in microseconds
+    file << "\",\"cat\":\"RaZ\",\"ph\":\"X\""
+         << ",\"ts\":" << static_cast<double>(event.startTime) / 1'000.0
+         << ",\"dur\":" << static_cast<double>(event.duration) / 1'000.0
+         << ",\"pid\":0,\"tid\":" << event.threadIndex << '}';
+  }
+
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void clear() {
+  ProfilerState& state = getState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  collectEvents(state, [] (const ZoneEvent&) {});
+
+  state.frameIndex = 0;
+  state.zones.clear();
+  state.capturedEvents.clear();
+}
+
+} // namespace Raz::Profiler
@@ -153,6 +153,28 @@ bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
 }
 
 bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
+  float minHitDist {};
+
+  if (!intersects(aabb, minHitDist))
+    return false;
+
+  // If reaching here with a negative distance (minHitDist < 0), this means that the ray's origin is inside the box
+  // Currently, in this case, the computed hit position represents the intersection behind the ray
+
+  if (hit) {
+    hit->position = m_origin + m_direction * minHitDist;
+
+    // Normal computing method based on John Novak's: http://blog.johnnovak.net/2016/10/22/the-nim-raytracer-project-part-4-calculating-box-normals/
+    const Vec3f hitDir = (hit->position - aabb.computeCentroid()) / aabb.computeHalfExtents();
+    hit->normal = Vec3f(std::trunc(hitDir[0]), std::trunc(hitDir[1]), std::trunc(hitDir[2])).normalize();
+
+    hit->distance = minHitDist;
+  }
+
+  return true;
+}
+
+bool Ray::intersects(const AABB& aabb, float& hitDistance) const {
   // Branchless algorithm based on Tavianator's:
   //  - https://tavianator.com/fast-branchless-raybounding-box-intersections/
   //  - https://tavianator.com/cgit/dimension.git/tree/libdimension/bvh/bvh.c#n196
@@ -175,19 +197,7 @@ bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
   if (maxHitDist < std::max(minHitDist, 0.f))
     return false;
 
-  // If reaching here with a negative distance (minHitDist < 0), this means that the ray's origin is inside the box
-  // Currently, in this case, the computed hit position represents the intersection behind the ray
-
-  if (hit) {
-    hit->position = m_origin + m_direction * minHitDist;
-
-    // Normal computing method based on John Novak's: http://blog.johnnovak.net/2016/10/22/the-nim-raytracer-project-part-4-calculating-box-normals/
-    const Vec3f hitDir = (hit->position - aabb.computeCentroid()) / aabb.computeHalfExtents();
-    hit->normal = Vec3f(std::trunc(hitDir[0]), std::trunc(hitDir[1]), std::trunc(hitDir[2])).normalize();
-
-    hit->distance = minHitDist;
-  }
-
+  hitDistance = minHitDist;
   return true;
 }
 
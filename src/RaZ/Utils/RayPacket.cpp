@@ -0,0 +1,260 @@
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/SimdUtils.hpp"
+
+#include <cassert>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+template <std::size_t Size>
+using FloatPack = SimdUtils::FloatPack<Size>;
+
+template <std::size_t Size>
+using MaskPack = SimdUtils::MaskPack<Size>;
+
+/// Components of 3D vectors, one per lane.
+template <std::size_t Size>
+struct Vec3Pack {
+  FloatPack<Size> x;
+  FloatPack<Size> y;
+  FloatPack<Size> z;
+
+  static Vec3Pack load(const std::array<float, Size>& xValues, const std::array<float, Size>& yValues, const std::array<float, Size>& zValues) noexcept {
+    return { FloatPack<Size>::load(xValues.data()), FloatPack<Size>::load(yValues.data()), FloatPack<Size>::load(zValues.data()) };
+  }
+
+  static Vec3Pack broadcast(const Vec3f& vec) noexcept {
+    return { FloatPack<Size>(vec.x()), FloatPack<Size>(vec.y()), FloatPack<Size>(vec.z()) };
+  }
+};
+
+// The operations below reproduce exactly the ones made by the scalar Vector functions, so that the results are identical
+
+template <std::size_t Size>
+Vec3Pack<Size> operator-(const Vec3Pack<Size>& vec1, const Vec3Pack<Size>& vec2) noexcept {
+  return { vec1.x - vec2.x, vec1.y - vec2.y, vec1.z - vec2.z };
+}
+
+template <std::size_t Size>
+FloatPack<Size> dot(const Vec3Pack<Size>& vec1, const Vec3Pack<Size>& vec2) noexcept {
+  return vec1.x * vec2.x + vec1.y * vec2.y + vec1.z * vec2.z;
+}
+
+template <std::size_t Size>
+Vec3Pack<Size> cross(const Vec3Pack<Size>& vec1, const Vec3Pack<Size>& vec2) noexcept {
+  return { vec1.y * vec2.z - vec1.z * vec2.y,
+           vec1.z * vec2.x - vec1.x * vec2.z,
+           vec1.x * vec2.y - vec1.y * vec2.x };
+}
+
+/// Computes the intersection between rays & boxes with the slab method, as done by Ray::intersects(const AABB&, float&).
+/// \tparam Size Number of lanes.
+/// \param minPos Boxes' minimum positions.
+/// \param maxPos Boxes' maximum positions.
+/// \param origin Rays' origins.
+/// \param invDirection Rays' inverse directions.
+/// \param minHitDist Distances from the rays' origins to the closest intersections.
+/// \return Mask of the lanes in which the ray intersects the box.
+template <std::size_t Size>
+MaskPack<Size> intersectSlabs(const Vec3Pack<Size>& minPos, const Vec3Pack<Size>& maxPos,
+                              const Vec3Pack<Size>& origin, const Vec3Pack<Size>& invDirection,
+                              FloatPack<Size>& minHitDist) noexcept {
+  const Vec3Pack<Size> minDist = minPos - origin;
+  const Vec3Pack<Size> maxDist = maxPos - origin;
+
+  const FloatPack<Size> minDistX = minDist.x * invDirection.x;
+  const FloatPack<Size> minDistY = minDist.y * invDirection.y;
+  const FloatPack<Size> minDistZ = minDist.z * invDirection.z;
+  const FloatPack<Size> maxDistX = maxDist.x * invDirection.x;
+  const FloatPack<Size> maxDistY = maxDist.y * invDirection.y;
+  const FloatPack<Size> maxDistZ = maxDist.z * invDirection.z;
+
+  minHitDist = max(min(minDistX, maxDistX), max(min(minDistY, maxDistY), min(minDistZ, maxDistZ)));
+  const FloatPack<Size> maxHitDist = min(max(minDistX, maxDistX), min(max(minDistY, maxDistY), max(minDistZ, maxDistZ)));
+
+  return ~(maxHitDist < max(minHitDist, FloatPack<Size>(0.f)));
+}
+
+} // namespace
+
+template <std::size_t Size>
+RayPacket<Size>::RayPacket(const Ray* rays, std::size_t rayCount) {
+  assert("Error: Too many rays given to the packet." && rayCount <= Size);
+
+  for (std::size_t rayIndex = 0; rayIndex < rayCount; ++rayIndex)
+    setRay(rayIndex, rays[rayIndex]);
+}
+
+template <std::size_t Size>
+void RayPacket<Size>::setRay(std::size_t rayIndex, const Ray& ray) {
+  assert("Error: The ray index is out of the packet's bounds." && rayIndex < Size);
+
+  m_originsX[rayIndex]       = ray.getOrigin().x();
+  m_originsY[rayIndex]       = ray.getOrigin().y();
+  m_originsZ[rayIndex]       = ray.getOrigin().z();
+  m_directionsX[rayIndex]    = ray.getDirection().x();
+  m_directionsY[rayIndex]    = ray.getDirection().y();
+  m_directionsZ[rayIndex]    = ray.getDirection().z();
+  m_invDirectionsX[rayIndex] = ray.getInverseDirection().x();
+  m_invDirectionsY[rayIndex] = ray.getInverseDirection().y();
+  m_invDirectionsZ[rayIndex] = ray.getInverseDirection().z();
+
+  m_activeMask |= (1u << rayIndex);
+}
+
+template <std::size_t Size>
+Ray RayPacket<Size>::getRay(std::size_t rayIndex) const {
+  assert("Error: The ray index is out of the packet's bounds." && rayIndex < Size);
+
+  return Ray(Vec3f(m_originsX[rayIndex], m_originsY[rayIndex], m_originsZ[rayIndex]),
+             Vec3f(m_directionsX[rayIndex], m_directionsY[rayIndex], m_directionsZ[rayIndex]));
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const AABB& aabb, std::array<float, Size>* hitDistances) const {
+  if (m_activeMask == 0)
+    return 0;
+
+  FloatPack<Size> minHitDist;
+  const MaskPack<Size> hitMask = intersectSlabs(Vec3Pack<Size>::broadcast(aabb.getLeftBottomBackPos()),
+                                                Vec3Pack<Size>::broadcast(aabb.getRightTopFrontPos()),
+                                                Vec3Pack<Size>::load(m_originsX, m_originsY, m_originsZ),
+                                                Vec3Pack<Size>::load(m_invDirectionsX, m_invDirectionsY, m_invDirectionsZ),
+                                                minHitDist);
+
+  const uint32_t hitBits = hitMask.getBits() & m_activeMask;
+
+  if (hitDistances && hitBits != 0) {
+    std::array<float, Size> distances {};
+    minHitDist.store(distances.data());
+
+    for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+      if (hitBits & (1u << rayIndex))
+        (*hitDistances)[rayIndex] = distances[rayIndex];
+    }
+  }
+
+  return hitBits;
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Triangle& triangle, std::array<RayHit, Size>* hits) const {
+  // Vectorized version of the Moller-Trumbore algorithm used by Ray::intersects(const Triangle&)
+
+  if (m_activeMask == 0)
+    return 0;
+
+  const Vec3f firstEdge  = triangle.getSecondPos() - triangle.getFirstPos();
+  const Vec3f secondEdge = triangle.getThirdPos() - triangle.getFirstPos();
+
+  const FloatPack<Size> zero(0.f);
+  const FloatPack<Size> one(1.f);
+
+  const Vec3Pack<Size> firstEdges  = Vec3Pack<Size>::broadcast(firstEdge);
+  const Vec3Pack<Size> secondEdges = Vec3Pack<Size>::broadcast(secondEdge);
+  const Vec3Pack<Size> directions  = Vec3Pack<Size>::load(m_directionsX, m_directionsY, m_directionsZ);
+
+  const Vec3Pack<Size> pVec         = cross(directions, secondEdges);
+  const FloatPack<Size> determinant = dot(firstEdges, pVec);
+
+  // Equivalent to the scalar check of the determinant being nearly equal to 0
+  MaskPack<Size> hitMask = (abs(determinant) > FloatPack<Size>(std::numeric_limits<float>::epsilon()));
+
+  const FloatPack<Size> invDeterm = one / determinant;
+
+  const Vec3Pack<Size> invPlaneDir     = Vec3Pack<Size>::load(m_originsX, m_originsY, m_originsZ) - Vec3Pack<Size>::broadcast(triangle.getFirstPos());
+  const FloatPack<Size> firstBaryCoord = dot(invPlaneDir, pVec) * invDeterm;
+  hitMask = hitMask & ~((firstBaryCoord < zero) | (firstBaryCoord > one));
+
+  const Vec3Pack<Size> qVec             = cross(invPlaneDir, firstEdges);
+  const FloatPack<Size> secondBaryCoord = dot(qVec, directions) * invDeterm;
+  hitMask = hitMask & ~((secondBaryCoord < zero) | (firstBaryCoord + secondBaryCoord > one));
+
+  const FloatPack<Size> hitDist = dot(secondEdges, qVec) * invDeterm;
+  hitMask = hitMask & ~(hitDist <= zero);
+
+  const uint32_t hitBits = hitMask.getBits() & m_activeMask;
+
+  if (hits && hitBits != 0) {
+    std::array<float, Size> distances {};
+    hitDist.store(distances.data());
+
+    const Vec3f normal = firstEdge.cross(secondEdge).normalize();
+
+    for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+      if ((hitBits & (1u << rayIndex)) == 0)
+        continue;
+
+      const Vec3f origin(m_originsX[rayIndex], m_originsY[rayIndex], m_originsZ[rayIndex]);
+      const Vec3f direction(m_directionsX[rayIndex], m_directionsY[rayIndex], m_directionsZ[rayIndex]);
+
+      RayHit& hit = (*hits)[rayIndex];
+
+      hit.position = origin + direction * distances[rayIndex];
+      hit.normal   = (normal.dot(direction) > 0.f ? -normal : normal);
+      hit.distance = distances[rayIndex];
+    }
+  }
+
+  return hitBits;
+}
+
+template <std::size_t Size>
+AABBPacket<Size>::AABBPacket(const AABB* boxes, std::size_t boxCount) {
+  assert("Error: Too many boxes given to the packet." && boxCount <= Size);
+
+  for (std::size_t boxIndex = 0; boxIndex < boxCount; ++boxIndex)
+    setBox(boxIndex, boxes[boxIndex]);
+}
+
+template <std::size_t Size>
+void AABBPacket<Size>::setBox(std::size_t boxIndex, const AABB& box) {
+  assert("Error: The box index is out of the packet's bounds." && boxIndex < Size);
+
+  m_minPositionsX[boxIndex] = box.getLeftBottomBackPos().x();
+  m_minPositionsY[boxIndex] = box.getLeftBottomBackPos().y();
+  m_minPositionsZ[boxIndex] = box.getLeftBottomBackPos().z();
+  m_maxPositionsX[boxIndex] = box.getRightTopFrontPos().x();
+  m_maxPositionsY[boxIndex] = box.getRightTopFrontPos().y();
+  m_maxPositionsZ[boxIndex] = box.getRightTopFrontPos().z();
+
+  m_activeMask |= (1u << boxIndex);
+}
+
+template <std::size_t Size>
+uint32_t AABBPacket<Size>::intersects(const Ray& ray, std::array<float, Size>* hitDistances) const {
+  if (m_activeMask == 0)
+    return 0;
+
+  FloatPack<Size> minHitDist;
+  const MaskPack<Size> hitMask = intersectSlabs(Vec3Pack<Size>::load(m_minPositionsX, m_minPositionsY, m_minPositionsZ),
+                                                Vec3Pack<Size>::load(m_maxPositionsX, m_maxPositionsY, m_maxPositionsZ),
+                                                Vec3Pack<Size>::broadcast(ray.getOrigin()),
+                                                Vec3Pack<Size>::broadcast(ray.getInverseDirection()),
+                                                minHitDist);
+
+  const uint32_t hitBits = hitMask.getBits() & m_activeMask;
+
+  if (hitDistances && hitBits != 0) {
+    std::array<float, Size> distances {};
+    minHitDist.store(distances.data());
+
+    for (std::size_t boxIndex = 0; boxIndex < Size; ++boxIndex) {
+      if (hitBits & (1u << boxIndex))
+        (*hitDistances)[boxIndex] = distances[boxIndex];
+    }
+  }
+
+  return hitBits;
+}
+
+template class RayPacket<4>;
+template class RayPacket<8>;
+
+template class AABBPacket<4>;
+template class AABBPacket<8>;
+
+} // namespace Raz
@@ -1,7 +1,28 @@
 #include "RaZ/Utils/Shape.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace Raz {
 
+namespace {
+
+AABB computePointsBoundingBox(std::initializer_list<Vec3f> points) {
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (const Vec3f& point : points) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      minPos[i] = std::min(minPos[i], point[i]);
+      maxPos[i] = std::max(maxPos[i], point[i]);
+    }
+  }
+
+  return AABB(minPos, maxPos);
+}
+
+} // namespace
+
 // Line functions
 
 bool Line::intersects(const Line&) const {
@@ -83,6 +104,10 @@ Vec3f Line::computeProjection(const Vec3f& point) const {
   return m_beginPos + lineVec * std::clamp(pointDist, 0.f, 1.f);
 }
 
+AABB Line::computeBoundingBox() const {
+  return computePointsBoundingBox({ m_beginPos, m_endPos });
+}
+
 // Plane functions
 
 bool Plane::intersects(const Plane& plane) const {
@@ -118,6 +143,10 @@ bool Plane::intersects(const OBB&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Plane::computeBoundingBox() const {
+  return AABB(Vec3f(-std::numeric_limits<float>::infinity()), Vec3f(std::numeric_limits<float>::infinity()));
+}
+
 // Sphere functions
 
 bool Sphere::contains(const Vec3f& point) const {
@@ -151,6 +180,10 @@ bool Sphere::intersects(const OBB&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Sphere::computeBoundingBox() const {
+  return AABB(m_centerPos - m_radius, m_centerPos + m_radius);
+}
+
 // Triangle functions
 
 bool Triangle::intersects(const Triangle&) const {
@@ -180,6 +213,10 @@ Vec3f Triangle::computeNormal() const {
   return firstEdge.cross(secondEdge).normalize();
 }
 
+AABB Triangle::computeBoundingBox() const {
+  return computePointsBoundingBox({ m_firstPos, m_secondPos, m_thirdPos });
+}
+
 void Triangle::makeCounterClockwise(const Vec3f& normal) {
   if (isCounterClockwise(normal))
     return;
@@ -207,6 +244,10 @@ Vec3f Quad::computeProjection(const Vec3f&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB Quad::computeBoundingBox() const {
+  return computePointsBoundingBox({ m_leftTopPos, m_rightTopPos, m_rightBottomPos, m_leftBottomPos });
+}
+
 // AABB functions
 
 bool AABB::contains(const Vec3f& point) const {
@@ -280,4 +321,18 @@ Vec3f OBB::computeProjection(const Vec3f&) const {
   throw std::runtime_error("Error: Not implemented yet.");
 }
 
+AABB OBB::computeBoundingBox() const {
+  const Vec3f halfExtents = m_aabb.computeHalfExtents();
+  Vec3f rotatedHalfExtents;
+
+  // Each rotated half extent is the sum of the original ones projected onto the corresponding axis
+  for (std::size_t widthIndex = 0; widthIndex < 3; ++widthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < 3; ++heightIndex)
+      rotatedHalfExtents[widthIndex] += halfExtents[heightIndex] * std::abs(m_rotation[heightIndex * 3 + widthIndex]);
+  }
+
+  const Vec3f centroid = computeCentroid();
+  return AABB(centroid - rotatedHalfExtents, centroid + rotatedHalfExtents);
+}
+
 } // namespace Raz
@@ -1,24 +1,166 @@
 #include "RaZ/Utils/Threading.hpp"
 
+#include <utility>
+
 #ifdef RAZ_THREADS_AVAILABLE
 
 namespace Raz::Threading {
 
+namespace {
+
+thread_local const ThreadPool* currentThreadPool = nullptr; ///< Pool owning the current thread, if it is a worker.
+thread_local std::size_t currentWorkerIndex = 0; ///< Index of the current thread in its pool, if it is a worker.
+
+} // namespace
+
 unsigned int getSystemThreadCount() noexcept {
   const unsigned int threadCount = std::thread::hardware_concurrency();
   return std::max(threadCount, 1u); // threadCount is 0 if undefined; returning 1 thread available in this case
 }
 
+ThreadPool::ThreadPool(std::size_t threadCount) {
+  assert("Error: The number of threads can't be 0." && threadCount != 0);
+
+  m_workers.reserve(threadCount);
+
+  for (std::size_t workerIndex = 0; workerIndex < threadCount; ++workerIndex)
+    m_workers.emplace_back(std::make_unique<Worker>());
+
+  // The threads are started only once all workers exist, since any of them may be stolen from
+  for (std::size_t workerIndex = 0; workerIndex < threadCount; ++workerIndex)
+    m_workers[workerIndex]->thread = std::thread(&ThreadPool::runWorker, this, workerIndex);
+}
+
+bool ThreadPool::runPendingTask() {
+  Task task;
+  const bool isWorker = (currentThreadPool == this);
+
+  if ((isWorker && popTask(currentWorkerIndex, task)) || stealTask((isWorker ? currentWorkerIndex : m_workers.size() - 1), task)) {
+    task();
+    return true;
+  }
+
+  return false;
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_isStopping = true;
+  }
+
+  m_wakeCondition.notify_all();
+
+  for (const std::unique_ptr<Worker>& worker : m_workers)
+    worker->thread.join();
+}
+
+void ThreadPool::enqueue(Task task) {
+  // A task added from a worker goes into its own queue, keeping related tasks on the same thread; tasks added from outside
+  //   of the pool are distributed among the workers
+  const std::size_t workerIndex = (currentThreadPool == this ? currentWorkerIndex
+                                                             : m_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % m_workers.size());
+
+  {
+    Worker& worker = *m_workers[workerIndex];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.emplace_back(std::move(task));
+  }
+
+  m_pendingTaskCount.fetch_add(1, std::memory_order_release);
+
+  // Locking the mutex guarantees that a worker can't miss the notification between checking for tasks & going to sleep
+  { std::lock_guard<std::mutex> lock(m_wakeMutex); }
+  m_wakeCondition.notify_one();
+}
+
+bool ThreadPool::popTask(std::size_t workerIndex, Task& task) {
+  Worker& worker = *m_workers[workerIndex];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+
+  if (worker.tasks.empty())
+    return false;
+
+  task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  m_pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+
+  return true;
+}
+
+bool ThreadPool::stealTask(std::size_t thiefIndex, Task& task) {
+  for (std::size_t offset = 1; offset <= m_workers.size(); ++offset) {
+    Worker& worker = *m_workers[(thiefIndex + offset) % m_workers.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.tasks.empty())
+      continue;
+
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    m_pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  return false;
+}
+
+void ThreadPool::runWorker(std::size_t workerIndex) {
+  currentThreadPool  = this;
+  currentWorkerIndex = workerIndex;
+
+  while (true) {
+    Task task;
+
+    if (popTask(workerIndex, task) || stealTask(workerIndex, task)) {
+      task();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    m_wakeCondition.wait(lock, [this] () { return (m_isStopping || m_pendingTaskCount.load(std::memory_order_acquire) > 0); });
+
+    // The remaining tasks are executed before stopping
+    if (m_isStopping && m_pendingTaskCount.load(std::memory_order_acquire) == 0)
+      return;
+  }
+}
+
+ThreadPool& getDefaultThreadPool() {
+  static ThreadPool threadPool;
+  return threadPool;
+}
+
+void TaskGroup::wait() {
+  waitForTasks();
+
+  std::lock_guard<std::mutex> lock(m_exceptionMutex);
+
+  if (m_exception)
+    std::rethrow_exception(std::exchange(m_exception, nullptr));
+}
+
+TaskGroup::~TaskGroup() {
+  waitForTasks();
+}
+
+void TaskGroup::waitForTasks() noexcept {
+  while (m_pendingTaskCount.load(std::memory_order_acquire) > 0) {
+    if (!m_threadPool.runPendingTask())
+      std::this_thread::yield();
+  }
+}
+
 void parallelize(const std::function<void()>& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
-  std::vector<std::thread> threads(threadCount);
+  TaskGroup taskGroup;
 
-  for (std::thread& thread : threads)
-    thread = std::thread(action);
+  for (std::size_t taskIndex = 0; taskIndex < threadCount; ++taskIndex)
+    taskGroup.run(action);
 
-  for (std::thread& thread : threads)
-    thread.join();
+  taskGroup.wait();
 }
 
 } // namespace Raz::Threading
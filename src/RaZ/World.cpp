@@ -1,82 +1,372 @@
 #include "RaZ/World.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <utility>
 
 namespace Raz {
 
+namespace {
+
+struct ThreadCommandBuffer {
+  std::size_t worldId {};
+  World::CommandBuffer* buffer {};
+};
+
+// Buffers the current thread has recorded into, by world; a world's ID is never reused, so that entries referring to a destroyed
+//   world can never be matched
+thread_local std::vector<ThreadCommandBuffer> threadCommandBuffers;
+
+} // namespace
+
+World::CommandBuffer::PendingEntity World::CommandBuffer::addEntity(bool enabled) {
+  const PendingEntity entity { m_pendingEntityCount++ };
+
+  m_commands.emplace_back([enabled] (World& world, std::vector<Entity*>& createdEntities) {
+    createdEntities.emplace_back(&world.addEntity(enabled));
+  });
+
+  return entity;
+}
+
+void World::CommandBuffer::enableEntity(const EntityHandle& handle, bool enabled) {
+  m_commands.emplace_back([handle, enabled] (World& world, std::vector<Entity*>&) {
+    Entity* entity = world.getEntity(handle);
+
+    if (entity != nullptr)
+      entity->enable(enabled);
+  });
+}
+
+void World::CommandBuffer::removeEntity(const EntityHandle& handle) {
+  m_commands.emplace_back([handle] (World& world, std::vector<Entity*>&) {
+    world.removeEntity(handle);
+  });
+}
+
+void World::CommandBuffer::clear() noexcept {
+  m_commands.clear();
+  m_pendingEntityCount = 0;
+}
+
+void World::CommandBuffer::execute(World& world) {
+  // Entities created by this buffer are referred to by their creation order; they can't be removed by the same buffer, since
+  //   no handle of theirs exists yet, so that their pointers remain valid throughout the execution
+  std::vector<Entity*> createdEntities;
+  createdEntities.reserve(m_pendingEntityCount);
+
+  for (Command& command : m_commands)
+    command(world, createdEntities);
+
+  clear();
+}
+
+World::World(std::size_t entityCount, ComponentStorageType componentStorageType) {
+  m_entities.reserve(entityCount);
+
+  if (componentStorageType == ComponentStorageType::DENSE)
+    m_componentStorage = std::make_unique<ComponentStorage>();
+}
+
+World::World(World&& world) noexcept
+  : m_systems{ std::move(world.m_systems) },
+    m_activeSystems{ std::move(world.m_activeSystems) },
+    m_systemGraph{ std::move(world.m_systemGraph) },
+    m_isSystemGraphDirty{ world.m_isSystemGraphDirty },
+    m_entities{ std::move(world.m_entities) },
+    m_activeEntityCount{ world.m_activeEntityCount },
+    m_maxEntityIndex{ world.m_maxEntityIndex },
+    m_entityPositions{ std::move(world.m_entityPositions) },
+    m_entityGenerations{ std::move(world.m_entityGenerations) },
+    m_freeEntityIndices{ std::move(world.m_freeEntityIndices) },
+    m_dirtyEntities{ std::move(world.m_dirtyEntities) },
+    m_isSortingNeeded{ world.m_isSortingNeeded },
+    m_componentStorage{ std::move(world.m_componentStorage) },
+    m_queries{ std::move(world.m_queries) },
+    m_id{ std::exchange(world.m_id, generateId()) },
+    m_commandBuffers{ std::move(world.m_commandBuffers) },
+    m_fixedTimeStep{ world.m_fixedTimeStep },
+    m_maxStepCount{ world.m_maxStepCount },
+    m_stepCount{ world.m_stepCount },
+    m_remainingTime{ world.m_remainingTime } {
+  updateOwnership();
+}
+
 Entity& World::addEntity(bool enabled) {
-  m_entities.emplace_back(Entity::create(m_maxEntityIndex++, enabled));
+  // An enabled entity added after disabled ones must be moved in front of them
+  const bool isSortingNeeded = (enabled && m_activeEntityCount < m_entities.size());
+
+  std::size_t entityIndex {};
+
+  if (m_freeEntityIndices.empty()) {
+    assert("Error: Entity IDs must be contiguous." && m_maxEntityIndex == m_entityPositions.size());
+
+    entityIndex = m_maxEntityIndex++;
+    m_entityPositions.emplace_back(m_entities.size());
+    m_entityGenerations.emplace_back(0);
+  } else {
+    // Recycling the index of a removed entity, whose generation has been incremented on removal
+    entityIndex = m_freeEntityIndices.back();
+    m_freeEntityIndices.pop_back();
+    m_entityPositions[entityIndex] = m_entities.size();
+  }
+
+  Entity& entity = *m_entities.emplace_back(Entity::create(entityIndex, enabled, m_componentStorage.get()));
+  entity.m_generation = m_entityGenerations[entityIndex];
+  entity.m_world      = this;
+
   m_activeEntityCount += enabled;
 
-  return *m_entities.back();
+  markDirty(entity, isSortingNeeded);
+
+  return entity;
+}
+
+bool World::isAlive(const EntityHandle& handle) const noexcept {
+  return (handle.index < m_entityGenerations.size()
+       && m_entityGenerations[handle.index] == handle.generation
+       && m_entityPositions[handle.index] != InvalidPosition);
+}
+
+Entity* World::getEntity(const EntityHandle& handle) const noexcept {
+  if (!isAlive(handle))
+    return nullptr;
+
+  return m_entities[m_entityPositions[handle.index]].get();
+}
+
+void World::removeEntity(const Entity& entity) {
+  assert("Error: The entity to be removed must be owned by the world." && entity.m_world == this);
+
+  const std::size_t entityIndex = entity.getId();
+  std::size_t entityPos         = m_entityPositions[entityIndex];
+
+  for (const std::unique_ptr<EntityQuery>& query : m_queries)
+    query->remove(entity);
+
+  // Each system unlinks the entity in constant time
+  for (const SystemPtr& system : m_systems) {
+    if (system && system->containsEntity(m_entities[entityPos]))
+      system->unlinkEntity(m_entities[entityPos]);
+  }
+
+  // If the entities are sorted, the last enabled entity takes the removed one's place, keeping the enabled entities in front
+  if (!m_isSortingNeeded && entityPos < m_activeEntityCount) {
+    --m_activeEntityCount;
+    swapEntities(entityPos, m_activeEntityCount);
+    entityPos = m_activeEntityCount;
+  }
+
+  swapEntities(entityPos, m_entities.size() - 1);
+  m_entities.pop_back(); // The entity is destroyed here, releasing its components
+  m_activeEntityCount = std::min(m_activeEntityCount, m_entities.size());
+
+  // The entity may still be marked as dirty; since its position is invalidated, it will be ignored on the next refresh
+  m_entityPositions[entityIndex] = InvalidPosition;
+  ++m_entityGenerations[entityIndex];
+  m_freeEntityIndices.emplace_back(entityIndex);
+}
+
+bool World::removeEntity(const EntityHandle& handle) {
+  const Entity* entity = getEntity(handle);
+
+  if (entity == nullptr)
+    return false;
+
+  removeEntity(*entity);
+  return true;
+}
+
+World::CommandBuffer& World::getCommandBuffer() {
+  for (const ThreadCommandBuffer& threadBuffer : threadCommandBuffers) {
+    if (threadBuffer.worldId == m_id)
+      return *threadBuffer.buffer;
+  }
+
+  CommandBuffer* buffer {};
+
+  {
+    std::lock_guard<std::mutex> lock(m_commandBuffersMutex);
+    buffer = m_commandBuffers.emplace_back(std::make_unique<CommandBuffer>()).get();
+  }
+
+  threadCommandBuffers.push_back({ m_id, buffer });
+
+  return *buffer;
+}
+
+void World::executeCommandBuffers() {
+  for (const std::unique_ptr<CommandBuffer>& buffer : m_commandBuffers) {
+    if (!buffer->isEmpty())
+      buffer->execute(*this);
+  }
+}
+
+void World::setFixedTimeStep(float timeStep) {
+  assert("Error: The fixed time step must be strictly positive." && timeStep > 0.f);
+
+  m_fixedTimeStep = timeStep;
+  m_remainingTime = std::fmod(m_remainingTime, m_fixedTimeStep);
+}
+
+void World::setMaxStepCount(std::size_t maxStepCount) {
+  assert("Error: The maximum number of fixed steps per update must be strictly positive." && maxStepCount > 0);
+  m_maxStepCount = maxStepCount;
 }
 
 bool World::update(float deltaTime) {
+  RAZ_PROFILE_ZONE("World::update");
+
+  // Structural changes recorded during the previous update are applied at this point, before the systems are relinked
+  executeCommandBuffers();
   refresh();
 
-  // The fixed time step may need to be user-definable later; moreover, it should probably be handled by the Application
-  constexpr float fixedTimeStep = 0.016666f;
+  if (m_isSystemGraphDirty) {
+    m_systemGraph.build(m_systems, m_activeSystems);
+    m_isSystemGraphDirty = false;
+  }
 
-  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
-    if (!m_activeSystems[systemIndex])
-      continue;
+  // The systems may be updated concurrently; the number of fixed steps they must execute is thus computed beforehand
+  m_remainingTime += deltaTime;
+  m_stepCount      = 0;
+
+  while (m_remainingTime >= m_fixedTimeStep && m_stepCount < m_maxStepCount) {
+    ++m_stepCount;
+    m_remainingTime -= m_fixedTimeStep;
+  }
+
+  // The steps exceeding the maximum are dropped; only the fraction of a step is kept, so that the interpolation factor remains valid
+  if (m_remainingTime >= m_fixedTimeStep)
+    m_remainingTime = std::fmod(m_remainingTime, m_fixedTimeStep);
 
+  m_systemGraph.execute([this, deltaTime] (std::size_t systemIndex) {
     System& system = *m_systems[systemIndex];
 
-    bool isSystemActive = system.update(deltaTime);
-    m_remainingTime    += deltaTime;
+    bool isSystemActive {};
 
-    while (m_remainingTime >= fixedTimeStep) {
-      isSystemActive   = system.step(fixedTimeStep) && isSystemActive;
-      m_remainingTime -= fixedTimeStep;
+    {
+      RAZ_PROFILE_ZONE("System::update");
+      isSystemActive = system.update(deltaTime);
     }
 
-    if (!isSystemActive)
-      m_activeSystems.setBit(systemIndex, false);
+    for (std::size_t stepIndex = 0; stepIndex < m_stepCount; ++stepIndex) {
+      RAZ_PROFILE_ZONE("System::step");
+      isSystemActive = system.step(m_fixedTimeStep) && isSystemActive;
+    }
+
+    return isSystemActive;
+  });
+
+  for (std::size_t nodeIndex = 0; nodeIndex < m_systemGraph.getNodeCount(); ++nodeIndex) {
+    const SystemNode& node = m_systemGraph.getNode(nodeIndex);
+
+    if (node.isSystemActive())
+      continue;
+
+    m_activeSystems.setBit(node.getSystemIndex(), false);
+    m_isSystemGraphDirty = true;
   }
 
   return !m_activeSystems.isEmpty();
 }
 
 void World::refresh() {
-  if (m_entities.empty())
+  RAZ_PROFILE_ZONE("World::refresh");
+
+  // If no entity has changed since the last refresh, the systems are already up to date
+  if (m_dirtyEntities.empty())
     return;
 
-  sortEntities();
+  if (m_isSortingNeeded) {
+    sortEntities();
+    m_isSortingNeeded = false;
+  }
+
+  for (const std::size_t entityId : m_dirtyEntities) {
+    // The entity may have been removed after having changed
+    if (m_entityPositions[entityId] == InvalidPosition)
+      continue;
 
-  for (std::size_t entityIndex = 0; entityIndex < m_activeEntityCount; ++entityIndex) {
-    const EntityPtr& entity = m_entities[entityIndex];
+    const EntityPtr& entity = m_entities[m_entityPositions[entityId]];
+    entity->m_isDirty = false;
 
     for (const SystemPtr& system : m_systems) {
-      const Bitset matchingComponents = system->getAcceptedComponents() & entity->getEnabledComponents();
-
-      // If the system doesn't contain the entity, check if it should (possesses the accepted components); if yes, link it
-      // Else, if the system contains the entity but shouldn't, unlink it
-      if (!system->containsEntity(entity)) {
-        if (!matchingComponents.isEmpty())
-          system->linkEntity(entity);
-      } else {
-        if (matchingComponents.isEmpty())
-          system->unlinkEntity(entity);
-      }
+      if (system)
+        updateLink(*system, entity);
     }
   }
+
+  m_dirtyEntities.clear();
 }
 
 void World::destroy() {
   // Entities must be released before the systems, since their destruction may depend on those
+  m_queries.clear();
   m_entities.clear();
   m_activeEntityCount = 0;
   m_maxEntityIndex    = 0;
+  m_entityPositions.clear();
+  m_entityGenerations.clear();
+  m_freeEntityIndices.clear();
+  m_dirtyEntities.clear();
+  m_isSortingNeeded = false;
 
   // This means that no entity must be used in any system destructor, since they will all be invalid
   // Their list is thus cleared to avoid any invalid usage
-  for (SystemPtr& system : m_systems)
+  for (SystemPtr& system : m_systems) {
+    if (!system)
+      continue;
+
     system->m_entities.clear();
+    system->m_entityPositions.clear();
+  }
 
   m_systems.clear();
   m_activeSystems.clear();
+  m_systemGraph        = SystemGraph();
+  m_isSystemGraphDirty = true;
+
+  // The threads may still refer to the released command buffers; the world thus needs a new ID so that they can't be matched
+  m_commandBuffers.clear();
+  m_id = generateId();
+}
+
+World& World::operator=(World&& world) noexcept {
+  m_systems            = std::move(world.m_systems);
+  m_activeSystems      = std::move(world.m_activeSystems);
+  m_systemGraph        = std::move(world.m_systemGraph);
+  m_isSystemGraphDirty = world.m_isSystemGraphDirty;
+  m_entities           = std::move(world.m_entities);
+  m_activeEntityCount  = world.m_activeEntityCount;
+  m_maxEntityIndex     = world.m_maxEntityIndex;
+  m_entityPositions    = std::move(world.m_entityPositions);
+  m_entityGenerations  = std::move(world.m_entityGenerations);
+  m_freeEntityIndices  = std::move(world.m_freeEntityIndices);
+  m_dirtyEntities      = std::move(world.m_dirtyEntities);
+  m_isSortingNeeded    = world.m_isSortingNeeded;
+  m_componentStorage   = std::move(world.m_componentStorage);
+  m_queries            = std::move(world.m_queries);
+  m_id                 = std::exchange(world.m_id, generateId());
+  m_commandBuffers     = std::move(world.m_commandBuffers);
+  m_fixedTimeStep      = world.m_fixedTimeStep;
+  m_maxStepCount       = world.m_maxStepCount;
+  m_stepCount          = world.m_stepCount;
+  m_remainingTime      = world.m_remainingTime;
+
+  updateOwnership();
+
+  return *this;
 }
 
 void World::sortEntities() {
+  if (m_entities.empty()) {
+    m_activeEntityCount = 0;
+    return;
+  }
+
   // Reorganizing the entites, swapping enabled & disabled ones so that the enabled ones are in front
   auto firstEntity = m_entities.begin();
   auto lastEntity  = m_entities.end() - 1;
@@ -97,10 +387,61 @@ void World::sortEntities() {
       break;
 
     std::swap(*firstEntity, *lastEntity);
+    std::swap(m_entityPositions[(*firstEntity)->getId()], m_entityPositions[(*lastEntity)->getId()]);
     --lastEntity;
   }
 
   m_activeEntityCount = static_cast<std::size_t>(std::distance(m_entities.begin(), lastEntity) + 1);
 }
 
+void World::markDirty(Entity& entity, bool enabledStateChanged) {
+  for (const std::unique_ptr<EntityQuery>& query : m_queries)
+    query->update(entity);
+
+  m_isSortingNeeded = (m_isSortingNeeded || enabledStateChanged);
+
+  if (entity.m_isDirty)
+    return;
+
+  entity.m_isDirty = true;
+  m_dirtyEntities.emplace_back(entity.getId());
+}
+
+void World::updateLink(System& system, const EntityPtr& entity) {
+  // An entity must be linked to a system if it is enabled & has at least one of the components the system accepts
+  const bool isAccepted = (entity->isEnabled() && system.getAcceptedComponents().intersects(entity->getEnabledComponents()));
+
+  if (isAccepted == system.containsEntity(entity))
+    return;
+
+  if (isAccepted)
+    system.linkEntity(entity);
+  else
+    system.unlinkEntity(entity);
+}
+
+void World::swapEntities(std::size_t firstPosition, std::size_t secondPosition) noexcept {
+  if (firstPosition == secondPosition)
+    return;
+
+  std::swap(m_entities[firstPosition], m_entities[secondPosition]);
+  m_entityPositions[m_entities[firstPosition]->getId()]  = firstPosition;
+  m_entityPositions[m_entities[secondPosition]->getId()] = secondPosition;
+}
+
+std::size_t World::generateId() noexcept {
+  static std::atomic<std::size_t> nextId = 0;
+  return nextId++;
+}
+
+void World::updateOwnership() noexcept {
+  for (const SystemPtr& system : m_systems) {
+    if (system)
+      system->m_world = this;
+  }
+
+  for (const EntityPtr& entity : m_entities)
+    entity->m_world = this;
+}
+
 } // namespace Raz
@@ -0,0 +1,65 @@
+#include "Catch.hpp"
+
+#include "RaZ/Application.hpp"
+
+namespace {
+
+class DeltaTimeSystem final : public Raz::System {
+public:
+  explicit DeltaTimeSystem(std::size_t updateCount) : m_remainingUpdateCount{ updateCount } {}
+
+  const std::vector<float>& getDeltaTimes() const noexcept { return m_deltaTimes; }
+
+  bool update(float deltaTime) override {
+    m_deltaTimes.emplace_back(deltaTime);
+    return (--m_remainingUpdateCount > 0);
+  }
+
+private:
+  std::size_t m_remainingUpdateCount {};
+  std::vector<float> m_deltaTimes {};
+};
+
+} // namespace
+
+TEST_CASE("Application fixed time step") {
+  Raz::Application app;
+  const auto& system = app.addWorld().addSystem<DeltaTimeSystem>(3);
+
+  app.setFixedTimeStep(0.5f);
+  CHECK(app.getFixedTimeStep() == 0.5f);
+
+  app.run();
+
+  // No window is needed; the worlds are stepped with the fixed time step, whatever the time actually elapsed
+  REQUIRE(system.getDeltaTimes().size() == 3);
+  CHECK(system.getDeltaTimes()[0] == 0.5f);
+  CHECK(system.getDeltaTimes()[1] == 0.5f);
+  CHECK(system.getDeltaTimes()[2] == 0.5f);
+
+  const Raz::Application::TickStats& tickStats = app.getTickStats();
+  CHECK(tickStats.tickCount == 3);
+  CHECK(tickStats.minTime <= tickStats.averageTime);
+  CHECK(tickStats.averageTime <= tickStats.maxTime);
+  CHECK(tickStats.lastTime >= tickStats.minTime);
+
+  app.resetTickStats();
+  CHECK(app.getTickStats().tickCount == 0);
+}
+
+TEST_CASE("Application target tick rate") {
+  Raz::Application app;
+  app.addWorld().addSystem<DeltaTimeSystem>(10);
+
+  app.setTargetTickRate(100.f);
+  CHECK(app.getTargetTickRate() == 100.f);
+
+  const auto startTime = std::chrono::steady_clock::now();
+  app.run();
+  const auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+  // The first cycle is run immediately, the 9 others being each run 10 milliseconds after the previous one
+  CHECK(app.getTickStats().tickCount == 10);
+  CHECK(elapsedTime >= std::chrono::milliseconds(89));
+  CHECK(app.getDeltaTime() > 0.005f);
+}
@@ -1,11 +1,26 @@
 #include "Catch.hpp"
 
 #include "RaZ/Component.hpp"
+#include "RaZ/Entity.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/Light.hpp"
 #include "RaZ/Render/Mesh.hpp"
 
+namespace {
+
+class TestComponent final : public Raz::Component {
+public:
+  explicit TestComponent(int value) : m_value{ value } {}
+
+  int getValue() const noexcept { return m_value; }
+
+private:
+  int m_value {};
+};
+
+} // namespace
+
 TEST_CASE("Components IDs") {
   // With the CRTP, every component gets a different constant ID with the first call
   // The ID is incremented with every distinct component call
@@ -22,3 +37,34 @@ TEST_CASE("Components IDs") {
   CHECK(meshIndex == Raz::Component::getId<Raz::Mesh>());
   CHECK(lightIndex == Raz::Component::getId<Raz::Light>());
 }
+
+TEST_CASE("Components allocation") {
+  const Raz::PoolAllocator<TestComponent>& allocator = Raz::Component::getAllocator<TestComponent>();
+  CHECK(allocator.getAllocatedCount() == 0);
+
+  {
+    Raz::Entity entity0(0);
+    Raz::Entity entity1(1);
+
+    // The components of the same type are allocated contiguously
+    const TestComponent& component0 = entity0.addComponent<TestComponent>(0);
+    const TestComponent& component1 = entity1.addComponent<TestComponent>(1);
+    CHECK(&component1 == &component0 + 1);
+    CHECK(allocator.getAllocatedCount() == 2);
+    CHECK(allocator.getSlabCount() == 1);
+
+    // A removed component gives its slot back, which is reused by the next one
+    entity0.removeComponent<TestComponent>();
+    CHECK(allocator.getAllocatedCount() == 1);
+
+    Raz::Entity entity2(2);
+    const TestComponent& component2 = entity2.addComponent<TestComponent>(2);
+    CHECK(&component2 == &component0);
+    CHECK(component2.getValue() == 2);
+    CHECK(entity1.getComponent<TestComponent>().getValue() == 1);
+  }
+
+  // Destroying the entities releases their components
+  CHECK(allocator.getAllocatedCount() == 0);
+  CHECK(allocator.getCapacity() > 0);
+}
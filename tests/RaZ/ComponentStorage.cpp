@@ -0,0 +1,97 @@
+#include "Catch.hpp"
+
+#include "RaZ/ComponentStorage.hpp"
+#include "RaZ/Math/Transform.hpp"
+
+TEST_CASE("ComponentPool basic") {
+  Raz::ComponentPool<Raz::Transform> pool;
+
+  CHECK(pool.getSize() == 0);
+  CHECK_FALSE(pool.contains(0));
+
+  pool.emplace(3, Raz::Vec3f(3.f));
+  pool.emplace(0, Raz::Vec3f(0.f));
+  pool.emplace(7, Raz::Vec3f(7.f));
+
+  CHECK(pool.getSize() == 3);
+  CHECK(pool.contains(0));
+  CHECK_FALSE(pool.contains(1));
+  CHECK(pool.contains(3));
+  CHECK(pool.contains(7));
+  CHECK_FALSE(pool.contains(42));
+
+  // Components are stored in the order they have been added
+  CHECK(pool.getEntityIndices() == std::vector<std::size_t>({ 3, 0, 7 }));
+  CHECK(pool.getAt(0).getPosition() == Raz::Vec3f(3.f));
+  CHECK(pool.getAt(1).getPosition() == Raz::Vec3f(0.f));
+  CHECK(pool.getAt(2).getPosition() == Raz::Vec3f(7.f));
+
+  CHECK(pool.get(7).getPosition() == Raz::Vec3f(7.f));
+  CHECK(&pool.get(7) == &pool.getAt(2));
+  CHECK(&pool.getAt(1) == &pool.getAt(0) + 1); // Components are contiguous
+
+  // Emplacing a component for an entity which already has one replaces it
+  pool.emplace(0, Raz::Vec3f(1.f));
+  CHECK(pool.getSize() == 3);
+  CHECK(pool.get(0).getPosition() == Raz::Vec3f(1.f));
+}
+
+TEST_CASE("ComponentPool removal") {
+  Raz::ComponentPool<Raz::Transform> pool;
+
+  for (std::size_t entityIndex = 0; entityIndex < 4; ++entityIndex)
+    pool.emplace(entityIndex, Raz::Vec3f(static_cast<float>(entityIndex)));
+
+  // Removing a component moves the last one in its place
+  pool.remove(1);
+
+  CHECK(pool.getSize() == 3);
+  CHECK_FALSE(pool.contains(1));
+  CHECK(pool.getEntityIndices() == std::vector<std::size_t>({ 0, 3, 2 }));
+  CHECK(pool.get(3).getPosition() == Raz::Vec3f(3.f));
+  CHECK(&pool.get(3) == &pool.getAt(1));
+
+  // Removing the last component doesn't move anything
+  pool.remove(2);
+  CHECK(pool.getEntityIndices() == std::vector<std::size_t>({ 0, 3 }));
+
+  // Removing a nonexistent component does nothing
+  pool.remove(2);
+  pool.remove(42);
+  CHECK(pool.getSize() == 2);
+
+  pool.remove(0);
+  pool.remove(3);
+  CHECK(pool.getSize() == 0);
+}
+
+TEST_CASE("ComponentPool pages") {
+  Raz::ComponentPool<Raz::Transform> pool;
+
+  constexpr std::size_t componentCount = Raz::ComponentPool<Raz::Transform>::PageSize + 1;
+
+  const Raz::Transform& firstTransform = pool.emplace(0);
+
+  for (std::size_t entityIndex = 1; entityIndex < componentCount; ++entityIndex)
+    pool.emplace(entityIndex, Raz::Vec3f(static_cast<float>(entityIndex)));
+
+  CHECK(pool.getSize() == componentCount);
+  CHECK(&pool.get(0) == &firstTransform); // Allocating a new page does not move the existing components
+  CHECK(pool.get(componentCount - 1).getPosition() == Raz::Vec3f(static_cast<float>(componentCount - 1)));
+}
+
+TEST_CASE("ComponentStorage pools") {
+  Raz::ComponentStorage storage;
+
+  CHECK_FALSE(storage.hasPool<Raz::Transform>());
+
+  Raz::ComponentPool<Raz::Transform>& pool = storage.getPool<Raz::Transform>();
+  CHECK(storage.hasPool<Raz::Transform>());
+  CHECK(&storage.getPool<Raz::Transform>() == &pool);
+
+  pool.emplace(0);
+  CHECK(pool.contains(0));
+
+  storage.removeComponent(Raz::Component::getId<Raz::Transform>(), 0);
+  CHECK_FALSE(pool.contains(0));
+}
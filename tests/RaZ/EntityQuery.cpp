@@ -0,0 +1,103 @@
+#include "Catch.hpp"
+
+#include "RaZ/EntityQuery.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+TEST_CASE("EntityQuery matching") {
+  Raz::Bitset components;
+  components.setBit(Raz::Component::getId<Raz::Transform>());
+  components.setBit(Raz::Component::getId<Raz::RigidBody>());
+
+  Raz::EntityQuery query(components);
+
+  Raz::Entity entity(0);
+  CHECK_FALSE(query.matches(entity));
+
+  entity.addComponent<Raz::Transform>();
+  CHECK_FALSE(query.matches(entity)); // All components are required
+
+  entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+  CHECK(query.matches(entity));
+
+  entity.disable();
+  CHECK_FALSE(query.matches(entity)); // Disabled entities are never matched
+}
+
+TEST_CASE("EntityQuery update") {
+  Raz::Bitset components;
+  components.setBit(Raz::Component::getId<Raz::Transform>());
+
+  Raz::EntityQuery query(components);
+
+  Raz::Entity entity0(0);
+  Raz::Entity entity1(1);
+  Raz::Entity entity2(2);
+
+  entity0.addComponent<Raz::Transform>();
+  entity2.addComponent<Raz::Transform>();
+
+  query.update(entity0);
+  query.update(entity1);
+  query.update(entity2);
+
+  CHECK(query.contains(entity0));
+  CHECK_FALSE(query.contains(entity1));
+  CHECK(query.contains(entity2));
+  CHECK(query.getEntities() == std::vector<Raz::Entity*>({ &entity0, &entity2 }));
+
+  // Updating an entity that has not changed does nothing
+  query.update(entity0);
+  CHECK(query.getEntities().size() == 2);
+
+  // Removing an entity moves the last one in its place
+  entity0.removeComponent<Raz::Transform>();
+  query.update(entity0);
+
+  CHECK_FALSE(query.contains(entity0));
+  CHECK(query.getEntities() == std::vector<Raz::Entity*>({ &entity2 }));
+
+  query.remove(entity2);
+  CHECK(query.getEntities().empty());
+}
+
+TEST_CASE("EntityView iteration") {
+  Raz::Bitset components;
+  components.setBit(Raz::Component::getId<Raz::Transform>());
+  components.setBit(Raz::Component::getId<Raz::RigidBody>());
+
+  Raz::EntityQuery query(components);
+
+  Raz::Entity entity0(0);
+  entity0.addComponent<Raz::Transform>(Raz::Vec3f(0.f));
+  entity0.addComponent<Raz::RigidBody>(0.f, 0.f);
+  query.update(entity0);
+
+  Raz::Entity entity1(1);
+  entity1.addComponent<Raz::Transform>(Raz::Vec3f(1.f));
+  entity1.addComponent<Raz::RigidBody>(1.f, 0.f);
+  query.update(entity1);
+
+  const Raz::EntityView<Raz::Transform, Raz::RigidBody> view(query);
+  CHECK(view.getSize() == 2);
+
+  std::size_t entityIndex = 0;
+
+  for (auto [transform, rigidBody] : view) {
+    CHECK(transform.getPosition() == Raz::Vec3f(static_cast<float>(entityIndex)));
+    CHECK(rigidBody.getMass() == static_cast<float>(entityIndex));
+    ++entityIndex;
+  }
+
+  CHECK(entityIndex == 2);
+
+  // The components fetched by the view are those held by the entities
+  view.forEach([] (Raz::Entity& entity, Raz::Transform& transform, const Raz::RigidBody&) {
+    CHECK(&transform == &entity.getComponent<Raz::Transform>());
+    transform.translate(1.f, 1.f, 1.f);
+  });
+
+  view.forEach([] (const Raz::Transform& transform, const Raz::RigidBody& rigidBody) {
+    CHECK(transform.getPosition() == Raz::Vec3f(rigidBody.getMass() + 1.f));
+  });
+}
@@ -156,6 +156,19 @@ TEST_CASE("Matrix/matrix operations") {
   CHECK((mat41 * Raz::Mat4f::identity()) == mat41);
 }
 
+TEST_CASE("Matrix inverse") {
+  CHECK(Raz::Mat4f::identity().inverse() == Raz::Mat4f::identity());
+
+  // Evaluating at compile time always uses the generic implementation, which the runtime one (possibly vectorized) must match
+  constexpr Raz::Mat4f mat41Inverse = mat41.inverse();
+  constexpr Raz::Mat4f mat42Inverse = mat42.inverse();
+  CHECK_THAT(mat41.inverse(), IsNearlyEqualToMatrix(mat41Inverse, 0.000001f));
+  CHECK_THAT(mat42.inverse(), IsNearlyEqualToMatrix(mat42Inverse, 0.000001f));
+
+  CHECK_THAT(mat41 * mat41.inverse(), IsNearlyEqualToMatrix(Raz::Mat4f::identity(), 0.00001f));
+  CHECK_THAT(mat42.inverse() * mat42, IsNearlyEqualToMatrix(Raz::Mat4f::identity(), 0.00001f));
+}
+
 TEST_CASE("Matrix/vector operations") {
   const Raz::Vec3f vec3(3.18f, 42.f, 0.874f);
   CHECK((mat31 * vec3) == Raz::Vec3f(1094.2069908f, 163.2942f, -312.50966f));
@@ -0,0 +1,85 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Math/TransformSystem.hpp"
+
+using namespace Raz::Literals;
+
+TEST_CASE("Transform cached matrices") {
+  Raz::Transform transform(Raz::Vec3f(1.f, 2.f, 3.f), Raz::Quaternionf(90_deg, Raz::Axis::Y), Raz::Vec3f(2.f));
+
+  CHECK_FALSE(transform.hasParent());
+  CHECK_THAT(transform.getLocalMatrix(), IsNearlyEqualToMatrix(transform.computeTransformMatrix()));
+  CHECK(&transform.getWorldMatrix() == &transform.getLocalMatrix());
+
+  transform.translate(1.f, 0.f, 0.f);
+  transform.rotate(45_deg, Raz::Axis::X);
+  transform.scale(0.5f);
+  CHECK_THAT(transform.getLocalMatrix(), IsNearlyEqualToMatrix(transform.computeTransformMatrix()));
+}
+
+TEST_CASE("TransformSystem hierarchy") {
+  // Creating a hierarchy so that the following configuration is reproduced:
+  //
+  //             / child11
+  //     / child1
+  // root
+  //     \ child2
+  //
+
+  Raz::World world(4);
+  auto& transformSystem = world.addSystem<Raz::TransformSystem>();
+
+  Raz::Entity& root    = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f, 0.f, 0.f));
+  Raz::Entity& child1  = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 1.f, 0.f));
+  Raz::Entity& child11 = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, 1.f));
+  Raz::Entity& child2  = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f), Raz::Quaternionf::identity(), Raz::Vec3f(2.f));
+
+  transformSystem.setParent(child11, child1);
+  transformSystem.setParent(child1, root);
+  transformSystem.setParent(child2, root);
+
+  CHECK(transformSystem.getParent(root) == nullptr);
+  CHECK(transformSystem.getParent(child1) == &root);
+  CHECK(transformSystem.getParent(child11) == &child1);
+  CHECK(transformSystem.getChildren(root).size() == 2);
+  CHECK(transformSystem.getChildren(child2).empty());
+
+  const auto& rootTrans    = root.getComponent<Raz::Transform>();
+  const auto& child1Trans  = child1.getComponent<Raz::Transform>();
+  const auto& child11Trans = child11.getComponent<Raz::Transform>();
+  const auto& child2Trans  = child2.getComponent<Raz::Transform>();
+
+  world.update({});
+  CHECK(transformSystem.getNodeCount() == 4);
+  CHECK_FALSE(rootTrans.hasParent());
+  CHECK(child11Trans.hasParent());
+
+  // The world matrix's last row holds the translation, which is the sum of all the parents' ones
+  CHECK_THAT(child11Trans.getWorldMatrix().recoverRow(3), IsNearlyEqualToVector(Raz::Vec4f(1.f, 1.f, 1.f, 1.f)));
+  CHECK_THAT(child2Trans.getWorldMatrix().recoverRow(3), IsNearlyEqualToVector(Raz::Vec4f(1.f, 0.f, 0.f, 1.f)));
+
+  // Moving the root updates all its descendants
+  root.getComponent<Raz::Transform>().setRotation(90_deg, Raz::Axis::Z);
+  world.update({});
+  CHECK_THAT(child1Trans.getWorldMatrix(), IsNearlyEqualToMatrix(child1Trans.getLocalMatrix() * rootTrans.getWorldMatrix()));
+  CHECK_THAT(child11Trans.getWorldMatrix(), IsNearlyEqualToMatrix(child11Trans.getLocalMatrix() * child1Trans.getWorldMatrix()));
+  CHECK_THAT(child11Trans.getWorldMatrix().recoverRow(3), IsNearlyEqualToVector(Raz::Vec4f(2.f, 0.f, 1.f, 1.f)));
+
+  // Detaching a child makes its transform relative to the world again
+  transformSystem.removeParent(child1);
+  CHECK_FALSE(child1Trans.hasParent());
+  world.update({});
+  CHECK(transformSystem.getNodeCount() == 4);
+  CHECK(&child1Trans.getWorldMatrix() == &child1Trans.getLocalMatrix());
+  CHECK_THAT(child11Trans.getWorldMatrix().recoverRow(3), IsNearlyEqualToVector(Raz::Vec4f(0.f, 1.f, 1.f, 1.f)));
+
+  // Removing a parent detaches its children
+  world.removeEntity(child1);
+  world.update({});
+  CHECK(transformSystem.getNodeCount() == 2);
+  CHECK_FALSE(child11Trans.hasParent());
+  CHECK(transformSystem.getParent(child11) == nullptr);
+  CHECK(transformSystem.getParent(child2) == &root);
+}
@@ -21,3 +21,50 @@ TEST_CASE("Collider basic") {
   CHECK(collider.getShapeType() == Raz::ShapeType::AABB);
   CHECK(collider.getShape<Raz::AABB>().computeCentroid() == Raz::Vec3f(0.f));
 }
+
+TEST_CASE("Collider intersections") {
+  const Raz::Collider lineCollider(Raz::Line(Raz::Vec3f(-2.f, 0.5f, 0.f), Raz::Vec3f(2.f, 0.5f, 0.f)));
+  const Raz::Collider planeCollider(Raz::Plane(1.f));
+  const Raz::Collider sphereCollider(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+  const Raz::Collider aabbCollider(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.f)));
+
+  const auto& line   = lineCollider.getShape<Raz::Line>();
+  const auto& plane  = planeCollider.getShape<Raz::Plane>();
+  const auto& sphere = sphereCollider.getShape<Raz::Sphere>();
+  const auto& aabb   = aabbCollider.getShape<Raz::AABB>();
+
+  // Collider/collider checks are dispatched to the same functions as the shapes' ones
+  CHECK(lineCollider.intersects(planeCollider) == line.intersects(plane));
+  CHECK(lineCollider.intersects(sphereCollider) == line.intersects(sphere));
+  CHECK(lineCollider.intersects(aabbCollider) == line.intersects(aabb));
+  CHECK(planeCollider.intersects(sphereCollider) == plane.intersects(sphere));
+  CHECK(planeCollider.intersects(aabbCollider) == plane.intersects(aabb));
+  CHECK(sphereCollider.intersects(planeCollider) == sphere.intersects(plane));
+  CHECK(sphereCollider.intersects(sphereCollider) == sphere.intersects(sphere));
+  CHECK(sphereCollider.intersects(aabbCollider) == sphere.intersects(aabb));
+  CHECK(aabbCollider.intersects(sphereCollider) == aabb.intersects(sphere));
+  CHECK(aabbCollider.intersects(aabbCollider) == aabb.intersects(aabb));
+  CHECK_THROWS(lineCollider.intersects(lineCollider));
+
+  CHECK(lineCollider.intersects(sphereCollider));
+  CHECK_FALSE(lineCollider.intersects(planeCollider));
+  CHECK(sphereCollider.intersects(aabbCollider));
+
+  // Collider/shape checks give the same results
+  CHECK(sphereCollider.intersects(static_cast<const Raz::Shape&>(aabb)) == aabb.intersects(sphere));
+  CHECK(planeCollider.intersects(static_cast<const Raz::Shape&>(line)) == line.intersects(plane));
+
+  const Raz::Ray ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y);
+  Raz::RayHit colliderHit;
+  Raz::RayHit shapeHit;
+
+  CHECK(sphereCollider.intersects(ray, &colliderHit));
+  CHECK(ray.intersects(sphere, &shapeHit));
+  CHECK(colliderHit.position == shapeHit.position);
+  CHECK(colliderHit.distance == shapeHit.distance);
+  CHECK_THROWS(lineCollider.intersects(ray));
+
+  CHECK(aabbCollider.computeBoundingBox().getLeftBottomBackPos() == aabb.getLeftBottomBackPos());
+  CHECK(aabbCollider.computeBoundingBox().getRightTopFrontPos() == aabb.getRightTopFrontPos());
+  CHECK(sphereCollider.computeBoundingBox().getRightTopFrontPos() == sphere.computeBoundingBox().getRightTopFrontPos());
+}
@@ -0,0 +1,351 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+TEST_CASE("PhysicsSystem integration") {
+  // Enough bodies are created for them to be integrated in parallel, with some not filling a whole pack
+  constexpr std::size_t bodyCount = 10'003;
+  constexpr float timeStep        = 0.01f;
+
+  Raz::World world(bodyCount);
+  world.setFixedTimeStep(timeStep);
+
+  const auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  std::vector<Raz::Vec3f> expectedPositions;
+  std::vector<Raz::Vec3f> expectedVelocities;
+  expectedPositions.reserve(bodyCount);
+  expectedVelocities.reserve(bodyCount);
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const auto bodyValue = static_cast<float>(bodyIndex);
+
+    // Every 5th body has an infinite mass
+    Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(bodyValue, -bodyValue, 0.f));
+    auto& rigidBody     = entity.addComponent<Raz::RigidBody>(static_cast<float>(bodyIndex % 5), 0.f);
+
+    const Raz::Vec3f velocity(bodyValue * 0.01f, 1.f, -bodyValue * 0.001f);
+    rigidBody.setVelocity(velocity);
+
+    // Semi-implicit Euler integration, in which the forces are scaled by the inverse mass
+    const Raz::Vec3f acceleration = physics.getGravity() * rigidBody.getInvMass();
+    const Raz::Vec3f newVelocity  = velocity * physics.getFriction() + acceleration * timeStep;
+    expectedVelocities.emplace_back(newVelocity);
+    expectedPositions.emplace_back(Raz::Vec3f(bodyValue, -bodyValue, 0.f) + (velocity + newVelocity) * 0.5f * timeStep);
+  }
+
+  world.update(timeStep);
+  REQUIRE(world.getStepCount() == 1);
+
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    const Raz::Entity& entity = *world.getEntities()[bodyIndex];
+
+    CHECK_THAT(entity.getComponent<Raz::RigidBody>().getVelocity(), IsNearlyEqualToVector(expectedVelocities[bodyIndex]));
+    CHECK_THAT(entity.getComponent<Raz::Transform>().getPosition(), IsNearlyEqualToVector(expectedPositions[bodyIndex]));
+  }
+}
+
+TEST_CASE("PhysicsSystem sleeping") {
+  constexpr float timeStep = 0.01f;
+
+  Raz::World world(3);
+  world.setFixedTimeStep(timeStep);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setSleepTime(0.1f);
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f));
+
+  Raz::Entity& lowerBody = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.5f, 0.f));
+  auto& lowerRigidBody   = lowerBody.addComponent<Raz::RigidBody>(1.f, 0.f);
+  lowerBody.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+  // The body falls onto the plane, then rests on it until being put to sleep
+  for (std::size_t stepIndex = 0; stepIndex < 100 && !lowerRigidBody.isSleeping(); ++stepIndex)
+    world.update(timeStep);
+
+  REQUIRE(lowerRigidBody.isSleeping());
+  CHECK(lowerRigidBody.getVelocity() == Raz::Vec3f(0.f));
+  CHECK(lowerBody.getComponent<Raz::Transform>().getPosition().y() >= 0.f);
+  CHECK(lowerBody.getComponent<Raz::Transform>().getPosition().y() < 0.01f);
+  CHECK(physics.getAwakeBodyCount() == 0);
+  CHECK(physics.getSleepingBodyCount() == 1);
+
+  // A sleeping body is not moved anymore
+  const Raz::Vec3f sleepingPos = lowerBody.getComponent<Raz::Transform>().getPosition();
+  world.update(timeStep);
+  CHECK(lowerBody.getComponent<Raz::Transform>().getPosition() == sleepingPos);
+
+  // An impulse wakes the body up
+  lowerRigidBody.applyImpulse(Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK_FALSE(lowerRigidBody.isSleeping());
+
+  world.update(timeStep);
+  CHECK(lowerBody.getComponent<Raz::Transform>().getPosition().y() > sleepingPos.y());
+  CHECK(physics.getAwakeBodyCount() == 1);
+  CHECK(physics.getSleepingBodyCount() == 0);
+
+  for (std::size_t stepIndex = 0; stepIndex < 100 && !lowerRigidBody.isSleeping(); ++stepIndex)
+    world.update(timeStep);
+
+  REQUIRE(lowerRigidBody.isSleeping());
+
+  // An awake body falling onto a sleeping one wakes it up
+  Raz::Entity& upperBody = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 1.5f, 0.f));
+  upperBody.addComponent<Raz::RigidBody>(1.f, 0.f);
+
+  for (std::size_t stepIndex = 0; stepIndex < 100 && lowerRigidBody.isSleeping(); ++stepIndex)
+    world.update(timeStep);
+
+  CHECK_FALSE(lowerRigidBody.isSleeping());
+  CHECK(upperBody.getComponent<Raz::Transform>().getPosition().y() > sleepingPos.y() + 0.5f);
+
+  // Sleeping can be disabled, waking all the sleeping bodies up
+  for (std::size_t stepIndex = 0; stepIndex < 200 && physics.getSleepingBodyCount() < 2; ++stepIndex)
+    world.update(timeStep);
+
+  CHECK(physics.getSleepingBodyCount() == 2);
+
+  physics.enableSleeping(false);
+  world.update(timeStep);
+  CHECK_FALSE(lowerRigidBody.isSleeping());
+  CHECK(physics.getAwakeBodyCount() == 2);
+  CHECK(physics.getSleepingBodyCount() == 0);
+}
+
+TEST_CASE("PhysicsSystem raycast") {
+  Raz::World world(12);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  // A ground plane, with a row of 10 unit spheres above it along the X axis
+  Raz::Entity& ground = world.addEntityWithComponent<Raz::Transform>();
+  ground.addComponent<Raz::Collider>(Raz::Plane(0.f));
+
+  std::vector<Raz::Entity*> spheres;
+
+  for (std::size_t sphereIndex = 0; sphereIndex < 10; ++sphereIndex) {
+    Raz::Entity& sphere = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(sphereIndex) * 3.f, 2.f, 0.f));
+    sphere.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+    spheres.emplace_back(&sphere);
+  }
+
+  // The colliders are taken into account once the physics has been stepped
+  const Raz::Ray rowRay(Raz::Vec3f(-5.f, 2.f, 0.f), Raz::Axis::X);
+  CHECK_FALSE(physics.raycast(rowRay));
+
+  physics.step(0.f);
+
+  Raz::RaycastHit hit;
+  REQUIRE(physics.raycast(rowRay, &hit));
+  CHECK(hit.entity == spheres.front());
+  CHECK_THAT(hit.rayHit.position, IsNearlyEqualToVector(Raz::Vec3f(-1.f, 2.f, 0.f)));
+  CHECK_THAT(hit.rayHit.normal, IsNearlyEqualToVector(-Raz::Axis::X));
+  CHECK(hit.rayHit.distance == 4.f);
+
+  CHECK_FALSE(physics.raycast(rowRay, nullptr, 3.9f));
+  CHECK_FALSE(physics.raycast(Raz::Ray(Raz::Vec3f(-5.f, 4.f, 0.f), Raz::Axis::X)));
+
+  // Colliders with infinite bounds, like the ground plane, can be hit as well
+  REQUIRE(physics.raycast(Raz::Ray(Raz::Vec3f(1.5f, 5.f, 0.f), -Raz::Axis::Y), &hit));
+  CHECK(hit.entity == &ground);
+  CHECK(hit.rayHit.distance == 5.f);
+
+  REQUIRE(physics.raycast(Raz::Ray(Raz::Vec3f(3.f, 5.f, 0.f), -Raz::Axis::Y), &hit));
+  CHECK(hit.entity == spheres[1]);
+  CHECK(hit.rayHit.distance == 2.f);
+
+  const std::vector<Raz::RaycastHit> rowHits = physics.raycastAll(rowRay);
+  REQUIRE(rowHits.size() == spheres.size());
+
+  for (std::size_t sphereIndex = 0; sphereIndex < spheres.size(); ++sphereIndex) {
+    CHECK(rowHits[sphereIndex].entity == spheres[sphereIndex]);
+    CHECK(rowHits[sphereIndex].rayHit.distance == static_cast<float>(sphereIndex) * 3.f + 4.f);
+  }
+
+  CHECK(physics.raycastAll(rowRay, 10.f).size() == 3);
+
+  // Enough rays are cast for them to be split into parallel batches, every other one missing everything
+  std::vector<Raz::Ray> rays;
+  for (std::size_t rayIndex = 0; rayIndex < 1000; ++rayIndex)
+    rays.emplace_back(Raz::Vec3f(static_cast<float>(rayIndex % 10) * 3.f, 5.f, 0.f), (rayIndex % 2 == 0 ? -Raz::Axis::Y : Raz::Axis::Y));
+
+  const std::vector<Raz::RaycastHit> hits = physics.raycastMany(rays);
+  REQUIRE(hits.size() == rays.size());
+
+  for (std::size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex) {
+    if (rayIndex % 2 == 0) {
+      CHECK(hits[rayIndex].entity == spheres[rayIndex % 10]);
+      CHECK(hits[rayIndex].rayHit.distance == 2.f);
+    } else {
+      CHECK(hits[rayIndex].entity == nullptr);
+    }
+  }
+
+  // Moved & removed colliders are updated on the next step
+  spheres.front()->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f, 10.f, 0.f));
+  spheres[1]->removeComponent<Raz::Collider>();
+  world.refresh();
+  physics.step(0.f);
+
+  REQUIRE(physics.raycast(rowRay, &hit));
+  CHECK(hit.entity == spheres[2]);
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f, 10.f, -5.f), Raz::Axis::Z), &hit));
+  CHECK(hit.entity == spheres.front());
+}
+
+TEST_CASE("PhysicsSystem continuous collision") {
+  Raz::World world(4);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+
+  // Two thin walls, each with a sphere body moving fast enough towards it to go through it in a single step
+  std::vector<Raz::Entity*> bodies;
+
+  for (std::size_t bodyIndex = 0; bodyIndex < 2; ++bodyIndex) {
+    const float depth = static_cast<float>(bodyIndex) * 10.f;
+
+    Raz::Entity& wall = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, depth));
+    wall.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.05f, -2.f, -2.f), Raz::Vec3f(0.05f, 2.f, 2.f)));
+
+    Raz::Entity& body = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-5.f, 0.f, depth));
+    body.addComponent<Raz::RigidBody>(1.f, 0.f).setVelocity(Raz::Vec3f(1000.f, 0.f, 0.f));
+    body.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+    bodies.emplace_back(&body);
+  }
+
+  auto& ccdBody = bodies[1]->getComponent<Raz::RigidBody>();
+  CHECK_FALSE(ccdBody.isCcdEnabled());
+  ccdBody.enableCcd();
+  CHECK(ccdBody.isCcdEnabled());
+
+  physics.step(0.01f);
+
+  // Without CCD, the body is considered as a point: it does not go through the wall, but its center stops on its surface
+  CHECK_THAT(bodies[0]->getComponent<Raz::Transform>().getPosition().x(), IsNearlyEqualTo(-0.052f, 0.000001f));
+
+  // With CCD, the sphere is swept & stops right before touching the wall
+  CHECK_THAT(bodies[1]->getComponent<Raz::Transform>().getPosition().x(), IsNearlyEqualTo(-0.552f, 0.001f));
+
+  // Both bodies have no bounciness, & are thus stopped by the wall
+  for (const Raz::Entity* body : bodies)
+    CHECK_THAT(body->getComponent<Raz::RigidBody>().getVelocity().x(), IsNearlyEqualTo(0.f, 0.0001f));
+}
+
+TEST_CASE("PhysicsSystem contact solver") {
+  Raz::World world(5);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+
+  // A ground & a wall forming a corner, which a body reaches by crossing both in the same step
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f));
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(-1.f, -Raz::Axis::X));
+
+  Raz::Entity& cornerBody = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.5f, 0.5f, 0.f));
+  cornerBody.addComponent<Raz::RigidBody>(1.f, 0.f).setVelocity(Raz::Vec3f(100.f, -80.f, 0.f));
+
+  physics.step(0.01f);
+
+  // Both contacts are solved together, the body being stopped by both surfaces
+  CHECK(physics.getContactCount() == 2);
+  CHECK(physics.getContactBatchCount() == 2); // Sharing the same body, the contacts cannot be solved concurrently
+
+  const Raz::Vec3f& cornerPos = cornerBody.getComponent<Raz::Transform>().getPosition();
+  CHECK_THAT(cornerPos.x(), IsNearlyEqualTo(0.998f, 0.0001f));
+  CHECK_THAT(cornerPos.y(), IsNearlyEqualTo(0.002f, 0.0001f));
+  CHECK_THAT(cornerBody.getComponent<Raz::RigidBody>().getVelocity(), IsNearlyEqualToVector(Raz::Vec3f(0.f), 0.0001f));
+
+  // A body hitting another one at rest shares its momentum with it
+  Raz::Entity& movingBody = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-5.f, 5.f, 0.f));
+  auto& movingRigidBody   = movingBody.addComponent<Raz::RigidBody>(1.f, 0.f);
+  movingRigidBody.setVelocity(Raz::Vec3f(100.f, 0.f, 0.f));
+
+  Raz::Entity& restingBody = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(-4.2f, 5.f, 0.f));
+  auto& restingRigidBody   = restingBody.addComponent<Raz::RigidBody>(3.f, 0.f);
+  restingBody.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+  physics.step(0.01f);
+
+  // Having no bounciness, both bodies end up moving together; the moving body's momentum, reduced by the friction, is conserved
+  const float momentum = 100.f * physics.getFriction();
+  CHECK_THAT(movingRigidBody.getVelocity().x(), IsNearlyEqualTo(momentum / 4.f, 0.0001f));
+  CHECK_THAT(restingRigidBody.getVelocity().x(), IsNearlyEqualTo(momentum / 4.f, 0.0001f));
+
+  // The penetration is split between the bodies according to their masses, the heavier one moving less
+  const float movingBodyPos  = movingBody.getComponent<Raz::Transform>().getPosition().x();
+  const float restingBodyPos = restingBody.getComponent<Raz::Transform>().getPosition().x();
+  CHECK_THAT(restingBodyPos - movingBodyPos, IsNearlyEqualTo(0.502f, 0.0001f));
+
+  const float integratedPos = -5.f + (100.f + momentum) * 0.5f * 0.01f;
+  CHECK_THAT(integratedPos - movingBodyPos, IsNearlyEqualTo((restingBodyPos + 4.2f) * 3.f, 0.0001f));
+}
+
+TEST_CASE("PhysicsSystem contact batches") {
+  // Enough bodies are falling onto the ground for their contacts to be solved in parallel
+  constexpr std::size_t bodyCount = 1'000;
+
+  Raz::World world(bodyCount + 1);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  physics.setGravity(Raz::Vec3f(0.f));
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f));
+
+  std::vector<Raz::Entity*> bodies;
+  for (std::size_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+    Raz::Entity& body = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(bodyIndex), 0.001f, 0.f));
+    body.addComponent<Raz::RigidBody>(1.f, 0.5f).setVelocity(Raz::Vec3f(0.f, -1.f, 0.f));
+    bodies.emplace_back(&body);
+  }
+
+  physics.step(0.01f);
+
+  // The ground being immovable, the contacts share no body & are all solved in a single batch
+  CHECK(physics.getContactCount() == bodyCount);
+  CHECK(physics.getContactBatchCount() == 1);
+
+  for (const Raz::Entity* body : bodies) {
+    CHECK_THAT(body->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(0.002f, 0.000001f));
+    CHECK_THAT(body->getComponent<Raz::RigidBody>().getVelocity().y(), IsNearlyEqualTo(physics.getFriction() * 0.5f, 0.000001f));
+  }
+}
+
+TEST_CASE("PhysicsSystem stacking") {
+  constexpr float timeStep = 0.01f;
+
+  Raz::World world(4);
+  world.setFixedTimeStep(timeStep);
+
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f));
+
+  std::vector<Raz::Entity*> bodies;
+  for (std::size_t bodyIndex = 0; bodyIndex < 3; ++bodyIndex) {
+    Raz::Entity& body = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, static_cast<float>(bodyIndex) * 1.5f + 0.5f, 0.f));
+    body.addComponent<Raz::RigidBody>(1.f, 0.f);
+    body.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+    bodies.emplace_back(&body);
+  }
+
+  // The bodies fall onto each other; pushed by the upper ones, the lower ones do not go through what is below them
+  for (std::size_t stepIndex = 0; stepIndex < 300; ++stepIndex) {
+    world.update(timeStep);
+
+    CHECK(bodies[0]->getComponent<Raz::Transform>().getPosition().y() > -0.01f);
+    CHECK(bodies[1]->getComponent<Raz::Transform>().getPosition().y() > bodies[0]->getComponent<Raz::Transform>().getPosition().y() + 0.49f);
+    CHECK(bodies[2]->getComponent<Raz::Transform>().getPosition().y() > bodies[1]->getComponent<Raz::Transform>().getPosition().y() + 0.49f);
+  }
+
+  // The stack comes to rest, each body's center lying on the one below, & is eventually put to sleep as a whole
+  CHECK(physics.getSleepingBodyCount() == 3);
+  CHECK_THAT(bodies[0]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(0.002f, 0.001f));
+  CHECK_THAT(bodies[1]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(0.504f, 0.001f));
+  CHECK_THAT(bodies[2]->getComponent<Raz::Transform>().getPosition().y(), IsNearlyEqualTo(1.006f, 0.001f));
+}
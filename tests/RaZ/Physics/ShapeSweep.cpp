@@ -0,0 +1,74 @@
+#include "Catch.hpp"
+
+#include "RaZ/Physics/ShapeSweep.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+TEST_CASE("ShapeSweep sphere") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f, 5.f, 0.f), 1.f);
+  const Raz::Vec3f translation(0.f, -10.f, 0.f);
+
+  Raz::SweepHit hit;
+
+  // The sphere touches the plane once its center is at a distance of its radius, after having moved 4 units
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(sphere, translation, Raz::Plane(0.f), &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.4f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y));
+
+  // Moving away from the plane never touches it, nor does being behind it
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(sphere, -translation, Raz::Plane(0.f)));
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(Raz::Sphere(Raz::Vec3f(0.f, -5.f, 0.f), 1.f), translation, Raz::Plane(0.f)));
+
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(sphere, translation, Raz::Sphere(Raz::Vec3f(0.f), 2.f), &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.2f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y));
+
+  // A thin box which would be missed by checking only the start & end positions is touched
+  const Raz::AABB thinBox(Raz::Vec3f(-2.f, -0.05f, -2.f), Raz::Vec3f(2.f, 0.05f, 2.f));
+  CHECK_FALSE(sphere.intersects(thinBox));
+  CHECK_FALSE(Raz::Sphere(sphere.getCenter() + translation, 1.f).intersects(thinBox));
+
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(sphere, translation, thinBox, &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.395f, 0.001f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y, 0.001f));
+
+  // A box next to the sphere's path is not touched
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(sphere, translation, Raz::AABB(Raz::Vec3f(1.5f, -1.f, -1.f), Raz::Vec3f(3.f, 1.f, 1.f))));
+
+  // A sphere already touching an obstacle touches it at time 0, unless moving away from it
+  const Raz::Sphere touchingSphere(Raz::Vec3f(0.f, 0.5f, 0.f), 1.f);
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(touchingSphere, translation, thinBox, &hit));
+  CHECK(hit.time == 0.f);
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(touchingSphere, -translation, thinBox));
+
+  // Not moving never touches anything
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(touchingSphere, Raz::Vec3f(0.f), thinBox));
+}
+
+TEST_CASE("ShapeSweep box") {
+  const Raz::AABB box(Raz::Vec3f(-1.f, 4.f, -1.f), Raz::Vec3f(1.f, 6.f, 1.f));
+  const Raz::Vec3f translation(0.f, -10.f, 0.f);
+
+  Raz::SweepHit hit;
+
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(box, translation, Raz::Plane(0.f), &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.4f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y));
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(box, -translation, Raz::Plane(0.f)));
+
+  const Raz::AABB thinBox(Raz::Vec3f(-2.f, -0.05f, -2.f), Raz::Vec3f(2.f, 0.05f, 2.f));
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(box, translation, thinBox, &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.395f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y));
+
+  // Moving sideways, the box hits the side of the obstacle
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(Raz::AABB(Raz::Vec3f(-6.f, -0.5f, -0.5f), Raz::Vec3f(-5.f, 0.5f, 0.5f)),
+                                             Raz::Vec3f(6.f, 0.f, 0.f), thinBox, &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.5f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(-Raz::Axis::X));
+
+  CHECK(Raz::ShapeSweep::computeTimeOfImpact(box, translation, Raz::Sphere(Raz::Vec3f(0.f), 2.f), &hit));
+  CHECK_THAT(hit.time, IsNearlyEqualTo(0.2f, 0.001f));
+  CHECK_THAT(hit.normal, IsNearlyEqualToVector(Raz::Axis::Y, 0.001f));
+
+  CHECK_FALSE(Raz::ShapeSweep::computeTimeOfImpact(box, translation, Raz::Sphere(Raz::Vec3f(3.5f, 0.f, 0.f), 2.f)));
+}
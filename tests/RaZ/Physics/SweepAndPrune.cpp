@@ -0,0 +1,90 @@
+#include "Catch.hpp"
+
+#include "RaZ/Physics/SweepAndPrune.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+TEST_CASE("SweepAndPrune overlapping pairs") {
+  Raz::SweepAndPrune broadphase;
+
+  broadphase.setProxy(0, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  broadphase.setProxy(1, Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.f)));
+  broadphase.setProxy(2, Raz::AABB(Raz::Vec3f(5.f), Raz::Vec3f(6.f)));
+  broadphase.setProxy(3, Raz::AABB(Raz::Vec3f(-1.f, 5.f, -1.f), Raz::Vec3f(1.f, 6.f, 1.f))); // Overlaps 0 on X & Z, but not on Y
+  CHECK(broadphase.getProxyCount() == 4);
+
+  CHECK(broadphase.computeOverlappingPairs() == std::vector<Raz::SweepAndPrune::ProxyPair>({ { 0, 1 } }));
+
+  // Moving the proxies so that 2 overlaps both 0 & 1; pairs are always ordered by ID
+  broadphase.setProxy(0, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  broadphase.setProxy(1, Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.f)));
+  broadphase.setProxy(2, Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(0.75f)));
+  broadphase.setProxy(3, Raz::AABB(Raz::Vec3f(-1.f, 5.f, -1.f), Raz::Vec3f(1.f, 6.f, 1.f)));
+
+  CHECK(broadphase.computeOverlappingPairs() == std::vector<Raz::SweepAndPrune::ProxyPair>({ { 0, 1 }, { 0, 2 }, { 1, 2 } }));
+
+  // Touching boxes are considered overlapping
+  broadphase.setProxy(0, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  broadphase.setProxy(3, Raz::AABB(Raz::Vec3f(-1.f, 1.f, -1.f), Raz::Vec3f(1.f, 6.f, 1.f)));
+
+  // Proxies that have not been set since the last computation are removed
+  CHECK(broadphase.computeOverlappingPairs() == std::vector<Raz::SweepAndPrune::ProxyPair>({ { 0, 3 } }));
+  CHECK(broadphase.getProxyCount() == 2);
+  CHECK(broadphase.hasProxy(0));
+  CHECK_FALSE(broadphase.hasProxy(1));
+  CHECK_FALSE(broadphase.hasProxy(2));
+  CHECK(broadphase.hasProxy(3));
+
+  broadphase.setProxy(0, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  broadphase.setProxy(3, Raz::AABB(Raz::Vec3f(-1.f, 1.f, -1.f), Raz::Vec3f(1.f, 6.f, 1.f)));
+  broadphase.removeProxy(3);
+  CHECK_FALSE(broadphase.hasProxy(3));
+  CHECK(broadphase.computeOverlappingPairs().empty());
+
+  broadphase.clear();
+  CHECK(broadphase.getProxyCount() == 0);
+  CHECK_FALSE(broadphase.hasProxy(0));
+}
+
+TEST_CASE("SweepAndPrune filtering") {
+  Raz::SweepAndPrune broadphase;
+
+  const Raz::AABB box(Raz::Vec3f(-1.f), Raz::Vec3f(1.f));
+
+  // Proxies of the first category can only be paired with the second one's, & reciprocally
+  broadphase.setProxy(0, box, 1, 2);
+  broadphase.setProxy(1, box, 1, 2);
+  broadphase.setProxy(2, box, 2, 1);
+  broadphase.setProxy(3, box, 2, 0); // Can't be paired with anything
+
+  CHECK(broadphase.computeOverlappingPairs() == std::vector<Raz::SweepAndPrune::ProxyPair>({ { 0, 2 }, { 1, 2 } }));
+}
+
+TEST_CASE("SweepAndPrune sweep axis") {
+  Raz::SweepAndPrune broadphase;
+  CHECK(broadphase.getSweepAxis() == 0);
+
+  // Spreading the proxies along Z; the next sweep is then made along this axis
+  for (std::size_t proxyIndex = 0; proxyIndex < 10; ++proxyIndex) {
+    const auto offset = static_cast<float>(proxyIndex) * 1.5f;
+    broadphase.setProxy(proxyIndex, Raz::AABB(Raz::Vec3f(0.f, 0.f, offset), Raz::Vec3f(1.f, 1.f, offset + 1.f)));
+  }
+
+  CHECK(broadphase.computeOverlappingPairs().empty());
+  CHECK(broadphase.getSweepAxis() == 2);
+
+  // Infinite boxes are paired with everything they overlap, & don't influence the sweep axis
+  for (std::size_t proxyIndex = 0; proxyIndex < 10; ++proxyIndex) {
+    const auto offset = static_cast<float>(proxyIndex) * 1.5f;
+    broadphase.setProxy(proxyIndex, Raz::AABB(Raz::Vec3f(0.f, 0.f, offset), Raz::Vec3f(1.f, 1.f, offset + 1.f)));
+  }
+
+  broadphase.setProxy(10, Raz::Plane(0.f).computeBoundingBox());
+
+  const std::vector<Raz::SweepAndPrune::ProxyPair>& pairs = broadphase.computeOverlappingPairs();
+  REQUIRE(pairs.size() == 10);
+
+  for (std::size_t proxyIndex = 0; proxyIndex < 10; ++proxyIndex)
+    CHECK(pairs[proxyIndex] == Raz::SweepAndPrune::ProxyPair(proxyIndex, 10));
+
+  CHECK(broadphase.getSweepAxis() == 2);
+}
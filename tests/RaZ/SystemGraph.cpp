@@ -0,0 +1,160 @@
+#include "Catch.hpp"
+
+#include "RaZ/SystemGraph.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <mutex>
+#include <thread>
+
+namespace {
+
+class ReadWriteSystem final : public Raz::System {
+public:
+  ReadWriteSystem(Raz::Bitset readComponents, Raz::Bitset writeComponents) {
+    m_readComponents  = std::move(readComponents);
+    m_writeComponents = std::move(writeComponents);
+  }
+};
+
+class ExclusiveSystem final : public Raz::System {};
+
+Raz::Bitset createSignature(std::initializer_list<std::size_t> componentIds) {
+  Raz::Bitset signature;
+
+  for (const std::size_t compId : componentIds)
+    signature.setBit(compId);
+
+  return signature;
+}
+
+} // namespace
+
+TEST_CASE("SystemGraph conflicts") {
+  const std::size_t transformId = Raz::Component::getId<Raz::Transform>();
+  const std::size_t rigidBodyId = Raz::Component::getId<Raz::RigidBody>();
+  const std::size_t colliderId  = Raz::Component::getId<Raz::Collider>();
+
+  const ReadWriteSystem transformReader(createSignature({ transformId }), {});
+  const ReadWriteSystem transformReader2(createSignature({ transformId, colliderId }), {});
+  const ReadWriteSystem transformWriter(createSignature({ colliderId }), createSignature({ transformId }));
+  const ReadWriteSystem rigidBodyWriter(createSignature({ colliderId }), createSignature({ rigidBodyId }));
+  const ExclusiveSystem exclusiveSystem;
+
+  CHECK_FALSE(exclusiveSystem.hasDeclaredAccesses());
+  CHECK(transformReader.hasDeclaredAccesses());
+
+  // Systems only reading the same components don't conflict
+  CHECK_FALSE(Raz::SystemGraph::areConflicting(transformReader, transformReader2));
+  CHECK_FALSE(Raz::SystemGraph::areConflicting(transformWriter, rigidBodyWriter));
+
+  // A system writing a component conflicts with any other accessing it
+  CHECK(Raz::SystemGraph::areConflicting(transformReader, transformWriter));
+  CHECK(Raz::SystemGraph::areConflicting(transformWriter, transformReader));
+  CHECK(Raz::SystemGraph::areConflicting(transformWriter, transformWriter));
+
+  // A system without declared accesses conflicts with all others
+  CHECK(Raz::SystemGraph::areConflicting(transformReader, exclusiveSystem));
+  CHECK(Raz::SystemGraph::areConflicting(exclusiveSystem, rigidBodyWriter));
+}
+
+TEST_CASE("SystemGraph build") {
+  const std::size_t transformId = Raz::Component::getId<Raz::Transform>();
+  const std::size_t rigidBodyId = Raz::Component::getId<Raz::RigidBody>();
+
+  std::vector<Raz::SystemPtr> systems;
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(createSignature({ transformId }), Raz::Bitset()));      // 0: Reads Transform
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(Raz::Bitset(), createSignature({ rigidBodyId })));      // 1: Writes RigidBody
+  systems.emplace_back(nullptr);                                                                               // 2: Ignored
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(createSignature({ rigidBodyId }), createSignature({ transformId }))); // 3
+  systems.emplace_back(std::make_unique<ExclusiveSystem>());                                                     // 4: Exclusive
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(createSignature({ transformId }), Raz::Bitset()));      // 5: Inactive
+
+  Raz::SystemGraph graph;
+  graph.build(systems, Raz::Bitset({ true, true, true, true, true, false }));
+
+  REQUIRE(graph.getNodeCount() == 4);
+  CHECK(graph.getNode(0).getSystemIndex() == 0);
+  CHECK(graph.getNode(1).getSystemIndex() == 1);
+  CHECK(graph.getNode(2).getSystemIndex() == 3);
+  CHECK(graph.getNode(3).getSystemIndex() == 4);
+
+  // 0 & 1 are independent, 3 depends on both, & the exclusive system depends on all of them
+  CHECK(graph.getNode(0).getParentCount() == 0);
+  CHECK(graph.getNode(1).getParentCount() == 0);
+  CHECK(graph.getNode(2).getParentCount() == 2);
+  CHECK(graph.getNode(3).getParentCount() == 3);
+
+  CHECK_FALSE(graph.getNode(0).isExclusive());
+  CHECK(graph.getNode(3).isExclusive());
+}
+
+TEST_CASE("SystemGraph execution") {
+  const std::size_t transformId = Raz::Component::getId<Raz::Transform>();
+  const std::size_t rigidBodyId = Raz::Component::getId<Raz::RigidBody>();
+
+  std::vector<Raz::SystemPtr> systems;
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(Raz::Bitset(), createSignature({ transformId })));
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(Raz::Bitset(), createSignature({ rigidBodyId })));
+  systems.emplace_back(std::make_unique<ReadWriteSystem>(createSignature({ rigidBodyId }), createSignature({ transformId })));
+  systems.emplace_back(std::make_unique<ExclusiveSystem>());
+
+  Raz::SystemGraph graph;
+  graph.build(systems, Raz::Bitset(systems.size(), true));
+
+  std::mutex mutex;
+  std::vector<std::size_t> executionOrder;
+  std::thread::id exclusiveThreadId;
+
+  graph.execute([&] (std::size_t systemIndex) {
+    if (systemIndex == 0)
+      std::this_thread::sleep_for(std::chrono::milliseconds(20)); // Making the first system the longest
+
+    std::lock_guard<std::mutex> lock(mutex);
+    executionOrder.emplace_back(systemIndex);
+
+    if (systemIndex == 3)
+      exclusiveThreadId = std::this_thread::get_id();
+
+    return (systemIndex != 1);
+  });
+
+  // All systems have been executed, each one after those it depends on
+  REQUIRE(executionOrder.size() == 4);
+  CHECK(std::find(executionOrder.cbegin(), executionOrder.cend(), 0) < std::find(executionOrder.cbegin(), executionOrder.cend(), 2));
+  CHECK(std::find(executionOrder.cbegin(), executionOrder.cend(), 1) < std::find(executionOrder.cbegin(), executionOrder.cend(), 2));
+  CHECK(executionOrder.back() == 3);
+
+  // The system without declared accesses has been executed on the calling thread
+  CHECK(exclusiveThreadId == std::this_thread::get_id());
+
+  CHECK(graph.getNode(0).isSystemActive());
+  CHECK_FALSE(graph.getNode(1).isSystemActive());
+
+  // The critical path goes through the longest system
+  const std::vector<const Raz::SystemNode*>& criticalPath = graph.getCriticalPath();
+  REQUIRE(criticalPath.size() == 3);
+  CHECK(criticalPath[0]->getSystemIndex() == 0);
+  CHECK(criticalPath[1]->getSystemIndex() == 2);
+  CHECK(criticalPath[2]->getSystemIndex() == 3);
+  CHECK(graph.getCriticalPathTime() >= 0.02f);
+  CHECK(graph.getCriticalPathTime() >= graph.getNode(0).getExecutionTime());
+
+  // Exceptions are rethrown once all systems have been executed
+  std::size_t executedCount = 0;
+
+  CHECK_THROWS(graph.execute([&executedCount, &mutex] (std::size_t systemIndex) -> bool {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++executedCount;
+    }
+
+    if (systemIndex == 0)
+      throw std::runtime_error("Error: Test exception");
+
+    return true;
+  }));
+
+  CHECK(executedCount == 4);
+}
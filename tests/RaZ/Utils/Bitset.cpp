@@ -102,3 +102,63 @@ TEST_CASE("Bitset printing") {
   stream << alternated1;
   CHECK(stream.str() == "[ 1; 0; 1; 0; 1; 0 ]");
 }
+
+TEST_CASE("Bitset signatures") {
+  CHECK(alternated1.intersects(fullOnes));
+  CHECK_FALSE(alternated1.intersects(alternated2));
+  CHECK_FALSE(alternated1.intersects(fullZeros));
+  CHECK_FALSE(alternated1.intersects(Raz::Bitset())); // Only the common bits are checked
+
+  CHECK(fullOnes.includes(alternated1));
+  CHECK(alternated1.includes(alternated1));
+  CHECK(alternated1.includes(fullZeros));
+  CHECK_FALSE(alternated1.includes(alternated2));
+  CHECK_FALSE(alternated1.includes(fullOnes));
+  CHECK(alternated1.includes(Raz::Bitset({ true, false, false, false, false, false, false, false }))); // Disabled bits past the size are ignored
+  CHECK_FALSE(Raz::Bitset().includes(alternated1));
+
+  std::vector<std::size_t> enabledBits;
+  alternated2.forEachEnabledBit([&enabledBits] (std::size_t bitIndex) { enabledBits.emplace_back(bitIndex); });
+  CHECK(enabledBits == std::vector<std::size_t>({ 1, 3, 5 }));
+
+  enabledBits.clear();
+  fullZeros.forEachEnabledBit([&enabledBits] (std::size_t bitIndex) { enabledBits.emplace_back(bitIndex); });
+  CHECK(enabledBits.empty());
+}
+
+TEST_CASE("Bitset large") {
+  // Bitsets larger than what can be stored inline must behave the same
+  Raz::Bitset largeBitset;
+  largeBitset.setBit(3);
+  largeBitset.setBit(Raz::Bitset::InlineBitCount + 10);
+
+  CHECK(largeBitset.getSize() == Raz::Bitset::InlineBitCount + 11);
+  CHECK(largeBitset.getEnabledBitCount() == 2);
+  CHECK(largeBitset[3]);
+  CHECK(largeBitset[Raz::Bitset::InlineBitCount + 10]);
+  CHECK_FALSE(largeBitset[Raz::Bitset::InlineBitCount + 9]);
+
+  std::vector<std::size_t> enabledBits;
+  largeBitset.forEachEnabledBit([&enabledBits] (std::size_t bitIndex) { enabledBits.emplace_back(bitIndex); });
+  CHECK(enabledBits == std::vector<std::size_t>({ 3, Raz::Bitset::InlineBitCount + 10 }));
+
+  const Raz::Bitset largeOnes(Raz::Bitset::InlineBitCount + 11, true);
+  CHECK(largeOnes.getDisabledBitCount() == 0);
+  CHECK((largeOnes & largeBitset) == largeBitset);
+  CHECK((~largeOnes).isEmpty());
+  CHECK(largeOnes.includes(largeBitset));
+  CHECK(largeBitset.intersects(alternated2));
+  CHECK_FALSE(largeBitset.intersects(alternated1));
+
+  // Shrinking the bitset stores it back inline, discarding the removed bits
+  largeBitset.resize(4);
+  CHECK(largeBitset == Raz::Bitset({ false, false, false, true }));
+
+  largeBitset.resize(Raz::Bitset::InlineBitCount + 11);
+  CHECK(largeBitset.getEnabledBitCount() == 1);
+
+  // A smaller bitset only affects the common bits
+  Raz::Bitset andBitset = largeOnes;
+  andBitset &= alternated1;
+  CHECK(andBitset.getEnabledBitCount() == largeOnes.getSize() - 3);
+}
@@ -0,0 +1,170 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/Bvh.hpp"
+
+#include <random>
+
+namespace {
+
+// Grid of 10x10x10 unit boxes, each separated by a unit gap
+Raz::Bvh createBoxGrid() {
+  Raz::Bvh bvh;
+
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const Raz::Vec3f minPos(static_cast<float>(i % 10) * 2.f, static_cast<float>((i / 10) % 10) * 2.f, static_cast<float>(i / 100) * 2.f);
+    bvh.insert(Raz::AABB(minPos, minPos + 1.f));
+  }
+
+  return bvh;
+}
+
+} // namespace
+
+TEST_CASE("Bvh basic") {
+  Raz::Bvh bvh;
+  CHECK(bvh.isEmpty());
+  CHECK_FALSE(bvh.castClosest(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::X)));
+
+  const std::size_t firstId  = bvh.insert(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  const std::size_t secondId = bvh.insert(Raz::AABB(Raz::Vec3f(4.f), Raz::Vec3f(5.f)));
+  CHECK(bvh.getPrimitiveCount() == 2);
+  CHECK(bvh.contains(firstId));
+  CHECK(bvh.contains(secondId));
+  CHECK(bvh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.f));
+  CHECK(bvh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(5.f));
+
+  bvh.update(secondId, Raz::AABB(Raz::Vec3f(2.f), Raz::Vec3f(3.f)));
+  CHECK(bvh.getPrimitiveBox(secondId).getLeftBottomBackPos() == Raz::Vec3f(2.f));
+  CHECK(bvh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(3.f));
+
+  bvh.remove(firstId);
+  CHECK(bvh.getPrimitiveCount() == 1);
+  CHECK_FALSE(bvh.contains(firstId));
+  CHECK(bvh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(2.f));
+
+  // The removed primitive's ID is reused
+  CHECK(bvh.insert(Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f))) == firstId);
+
+  bvh.clear();
+  CHECK(bvh.isEmpty());
+  CHECK_FALSE(bvh.contains(secondId));
+}
+
+TEST_CASE("Bvh ray casts") {
+  Raz::Bvh bvh = createBoxGrid();
+  bvh.build();
+
+  // Casting a ray along the X axis through the first row of boxes
+  const Raz::Ray ray(Raz::Vec3f(-5.f, 0.5f, 0.5f), Raz::Axis::X);
+
+  Raz::BvhHit hit;
+  CHECK(bvh.castClosest(ray, &hit));
+  CHECK(hit.primitiveId == 0);
+  CHECK(hit.rayHit.position == Raz::Vec3f(0.f, 0.5f, 0.5f));
+  CHECK(hit.rayHit.normal == -Raz::Axis::X);
+  CHECK(hit.rayHit.distance == 5.f);
+
+  CHECK(bvh.castAny(ray, &hit));
+  CHECK(hit.primitiveId < 10);
+
+  const std::vector<Raz::BvhHit> hits = bvh.castAll(ray);
+  REQUIRE(hits.size() == 10);
+
+  for (std::size_t hitIndex = 0; hitIndex < hits.size(); ++hitIndex)
+    CHECK(hits[hitIndex].primitiveId == hitIndex);
+
+  // Limiting the distance excludes the farthest boxes
+  CHECK(bvh.castAll(ray, 10.f).size() == 3);
+  CHECK_FALSE(bvh.castClosest(ray, nullptr, 4.f));
+  CHECK_FALSE(bvh.castAny(ray, nullptr, 4.f));
+
+  // A ray passing between the boxes hits nothing
+  CHECK_FALSE(bvh.castClosest(Raz::Ray(Raz::Vec3f(-5.f, 1.5f, 0.5f), Raz::Axis::X)));
+  CHECK_FALSE(bvh.castAny(Raz::Ray(Raz::Vec3f(-5.f, 1.5f, 0.5f), Raz::Axis::X)));
+}
+
+TEST_CASE("Bvh closest hit consistency") {
+  // The closest hits found by the hierarchy must be the same as the ones found by testing every box, both with a tree
+  //  built incrementally & with one built from scratch
+  Raz::Bvh bvh = createBoxGrid();
+
+  std::vector<Raz::AABB> boxes;
+  for (std::size_t primitiveId = 0; primitiveId < bvh.getPrimitiveCount(); ++primitiveId)
+    boxes.emplace_back(bvh.getPrimitiveBox(primitiveId));
+
+  std::mt19937 randGenerator(42);
+  std::uniform_real_distribution<float> posDistrib(-5.f, 25.f);
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  for (bool isBuilt : { false, true }) {
+    if (isBuilt)
+      bvh.build();
+
+    for (std::size_t rayIndex = 0; rayIndex < 100; ++rayIndex) {
+      const Raz::Ray ray(Raz::Vec3f(posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator)),
+                         Raz::Vec3f(dirDistrib(randGenerator), dirDistrib(randGenerator), dirDistrib(randGenerator)).normalize());
+
+      float closestDist = std::numeric_limits<float>::max();
+
+      for (const Raz::AABB& box : boxes) {
+        Raz::RayHit boxHit;
+
+        if (ray.intersects(box, &boxHit))
+          closestDist = std::min(closestDist, boxHit.distance);
+      }
+
+      Raz::BvhHit hit;
+      CHECK(bvh.castClosest(ray, &hit) == (closestDist < std::numeric_limits<float>::max()));
+      CHECK(hit.rayHit.distance == closestDist);
+    }
+  }
+}
+
+TEST_CASE("Bvh shapes") {
+  Raz::Sphere sphere(Raz::Vec3f(0.f, 0.f, -5.f), 1.f);
+  const Raz::Triangle triangle(Raz::Vec3f(-1.f, -1.f, -10.f), Raz::Vec3f(1.f, -1.f, -10.f), Raz::Vec3f(0.f, 1.f, -10.f));
+
+  Raz::Bvh bvh;
+  const std::size_t sphereId   = bvh.insert(static_cast<const Raz::Shape&>(sphere));
+  const std::size_t triangleId = bvh.insert(triangle);
+
+  const Raz::Ray ray(Raz::Vec3f(0.f), -Raz::Axis::Z);
+
+  Raz::BvhHit hit;
+  CHECK(bvh.castClosest(ray, &hit));
+  CHECK(hit.primitiveId == sphereId);
+  CHECK(hit.rayHit.distance == 4.f);
+
+  // Moving the sphere behind the triangle; the hierarchy must be refit to account for it
+  sphere = Raz::Sphere(Raz::Vec3f(0.f, 0.f, -20.f), 1.f);
+  bvh.refit();
+  CHECK(bvh.getPrimitiveBox(sphereId).getRightTopFrontPos() == Raz::Vec3f(1.f, 1.f, -19.f));
+
+  CHECK(bvh.castClosest(ray, &hit));
+  CHECK(hit.primitiveId == triangleId);
+  CHECK(hit.rayHit.distance == 10.f);
+
+  sphere = Raz::Sphere(Raz::Vec3f(0.f, 0.f, -2.f), 1.f);
+  bvh.update(sphereId);
+
+  CHECK(bvh.castClosest(ray, &hit));
+  CHECK(hit.primitiveId == sphereId);
+  CHECK(bvh.castAll(ray).size() == 2);
+}
+
+TEST_CASE("Bvh overlaps") {
+  Raz::Bvh bvh = createBoxGrid();
+
+  // Overlapping the first 2x2x2 boxes
+  std::vector<std::size_t> overlaps = bvh.queryOverlaps(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.5f)));
+  std::sort(overlaps.begin(), overlaps.end());
+  CHECK(overlaps == std::vector<std::size_t>({ 0, 1, 10, 11, 100, 101, 110, 111 }));
+
+  bvh.remove(0);
+  bvh.remove(111);
+  overlaps = bvh.queryOverlaps(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.5f)));
+  std::sort(overlaps.begin(), overlaps.end());
+  CHECK(overlaps == std::vector<std::size_t>({ 1, 10, 11, 100, 101, 110 }));
+
+  CHECK(bvh.queryOverlaps(Raz::AABB(Raz::Vec3f(-5.f), Raz::Vec3f(-1.f))).empty());
+}
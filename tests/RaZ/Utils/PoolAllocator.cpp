@@ -0,0 +1,76 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/PoolAllocator.hpp"
+
+#include <cstdint>
+
+namespace {
+
+struct alignas(32) AlignedValue {
+  uint64_t value {};
+};
+
+} // namespace
+
+TEST_CASE("PoolAllocator basic") {
+  // Each slot being at least as large as a pointer, values of 64 bits are used to check the allocations' contiguity
+  Raz::PoolAllocator<uint64_t, 4> allocator;
+  CHECK(allocator.getSlabCount() == 0);
+  CHECK(allocator.getCapacity() == 0);
+  CHECK(allocator.getAllocatedCount() == 0);
+
+  uint64_t* value0 = allocator.allocate();
+  CHECK(allocator.getSlabCount() == 1);
+  CHECK(allocator.getCapacity() == 4);
+  CHECK(allocator.getAllocatedCount() == 1);
+
+  // Successive allocations are contiguous in memory
+  uint64_t* value1 = allocator.allocate();
+  uint64_t* value2 = allocator.allocate();
+  uint64_t* value3 = allocator.allocate();
+  CHECK(value1 == value0 + 1);
+  CHECK(value2 == value0 + 2);
+  CHECK(value3 == value0 + 3);
+  CHECK(allocator.getSlabCount() == 1);
+  CHECK(allocator.getAllocatedCount() == 4);
+
+  // Once all slots are occupied, a new slab is reserved
+  uint64_t* value4 = allocator.allocate();
+  CHECK(allocator.getSlabCount() == 2);
+  CHECK(allocator.getCapacity() == 8);
+  CHECK(allocator.getAllocatedCount() == 5);
+
+  // Freed slots are reused before any other
+  allocator.deallocate(value1);
+  CHECK(allocator.getAllocatedCount() == 4);
+  CHECK(allocator.allocate() == value1);
+
+  allocator.deallocate(value2);
+  allocator.deallocate(value3);
+  CHECK(allocator.allocate() == value3);
+  CHECK(allocator.allocate() == value2);
+  CHECK(allocator.getSlabCount() == 2);
+
+  allocator.deallocate(nullptr); // Deallocating a null pointer does nothing
+  CHECK(allocator.getAllocatedCount() == 5);
+
+  allocator.deallocate(value0);
+  allocator.deallocate(value1);
+  allocator.deallocate(value2);
+  allocator.deallocate(value3);
+  allocator.deallocate(value4);
+  CHECK(allocator.getAllocatedCount() == 0);
+  CHECK(allocator.getCapacity() == 8); // The slabs are kept to be reused
+}
+
+TEST_CASE("PoolAllocator alignment") {
+  Raz::PoolAllocator<AlignedValue, 3> allocator;
+
+  for (std::size_t i = 0; i < 5; ++i) {
+    AlignedValue* value = new (allocator.allocate()) AlignedValue{ i };
+    CHECK(reinterpret_cast<uintptr_t>(value) % alignof(AlignedValue) == 0);
+    CHECK(value->value == i);
+  }
+
+  CHECK(allocator.getSlabCount() == 2);
+}
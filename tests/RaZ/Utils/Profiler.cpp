@@ -0,0 +1,147 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+const Raz::Profiler::ZoneStats* findStats(const std::vector<Raz::Profiler::ZoneStats>& stats, std::string_view name) {
+  const auto statsIter = std::find_if(stats.cbegin(), stats.cend(), [name] (const Raz::Profiler::ZoneStats& zoneStats) {
+    return (zoneStats.name == name);
+  });
+
+  return (statsIter != stats.cend() ? &*statsIter : nullptr);
+}
+
+} // namespace
+
+TEST_CASE("Profiler zone stats") {
+  Raz::Profiler::clear();
+  Raz::Profiler::setStatsFrameCount(2);
+
+  for (std::size_t frameIndex = 0; frameIndex < 3; ++frameIndex) {
+    {
+      const Raz::Profiler::ScopedZone outerZone("Outer");
+
+      for (std::size_t callIndex = 0; callIndex < 2; ++callIndex) {
+        const Raz::Profiler::ScopedZone innerZone("Inner");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    Raz::Profiler::endFrame();
+  }
+
+  const std::vector<Raz::Profiler::ZoneStats> stats = Raz::Profiler::getZoneStats();
+  REQUIRE(stats.size() == 2);
+
+  // The stats are sorted by decreasing average time; the outer zone includes the inner one
+  CHECK(stats[0].name == "Outer");
+  CHECK(stats[1].name == "Inner");
+
+  // Only the last 2 frames are taken into account
+  const Raz::Profiler::ZoneStats& innerStats = stats[1];
+  CHECK(innerStats.frameCount == 2);
+  CHECK(innerStats.callCount == 4);
+  CHECK(innerStats.minTime >= 2.0);
+  CHECK(innerStats.minTime <= innerStats.averageTime);
+  CHECK(innerStats.averageTime <= innerStats.maxTime);
+  CHECK(innerStats.lastTime > 0.0);
+
+  // A zone not executed during the last frame keeps its stats, but has no last time
+  Raz::Profiler::endFrame();
+  CHECK(findStats(Raz::Profiler::getZoneStats(), "Inner")->lastTime == 0.0);
+
+  // After enough frames without any execution, the zone has no stats anymore
+  Raz::Profiler::endFrame();
+  CHECK(findStats(Raz::Profiler::getZoneStats(), "Inner") == nullptr);
+
+  Raz::Profiler::setStatsFrameCount(120);
+  Raz::Profiler::clear();
+}
+
+TEST_CASE("Profiler capture") {
+  Raz::Profiler::clear();
+
+  {
+    const Raz::Profiler::ScopedZone zone("Uncaptured");
+  }
+
+  Raz::Profiler::endFrame();
+
+  Raz::Profiler::startCapture();
+  CHECK(Raz::Profiler::isCapturing());
+
+  {
+    const Raz::Profiler::ScopedZone outerZone("Outer");
+    const Raz::Profiler::ScopedZone innerZone("Inner");
+  }
+
+  Raz::Profiler::endFrame();
+  Raz::Profiler::stopCapture();
+  CHECK_FALSE(Raz::Profiler::isCapturing());
+
+  {
+    const Raz::Profiler::ScopedZone zone("Uncaptured");
+  }
+
+  Raz::Profiler::endFrame();
+
+  // The zones are recorded when they are left; the inner one is thus recorded first
+  const std::vector<Raz::Profiler::ZoneEvent> events = Raz::Profiler::getCapturedEvents();
+  REQUIRE(events.size() == 2);
+  CHECK(std::string_view(events[0].name) == "Inner");
+  CHECK(events[0].depth == 1);
+  CHECK(std::string_view(events[1].name) == "Outer");
+  CHECK(events[1].depth == 0);
+  CHECK(events[1].startTime <= events[0].startTime);
+  CHECK(events[1].duration >= events[0].duration);
+  CHECK(events[0].threadIndex == events[1].threadIndex);
+
+  const Raz::FilePath traceFilePath = "téstTrace.json";
+  Raz::Profiler::exportChromeTrace(traceFilePath);
+
+  std::ifstream traceFile(traceFilePath, std::ios_base::in | std::ios_base::binary);
+  REQUIRE(traceFile);
+
+  std::stringstream traceContent;
+  traceContent << traceFile.rdbuf();
+  const std::string trace = traceContent.str();
+
+  CHECK(trace.rfind("{\"traceEvents\":[", 0) == 0);
+  CHECK(trace.find("\"name\":\"Outer\"") != std::string::npos);
+  CHECK(trace.find("\"name\":\"Inner\"") != std::string::npos);
+  CHECK(trace.find("Uncaptured") == std::string::npos);
+  CHECK(trace.find("\"ph\":\"X\"") != std::string::npos);
+
+  Raz::Profiler::clear();
+}
+
+#ifdef RAZ_THREADS_AVAILABLE
+TEST_CASE("Profiler multithreaded zones") {
+  Raz::Profiler::clear();
+  Raz::Profiler::startCapture();
+
+  Raz::Threading::parallelize([] () {
+    for (std::size_t zoneIndex = 0; zoneIndex < 100; ++zoneIndex)
+      const Raz::Profiler::ScopedZone zone("Parallel");
+  }, 4);
+
+  Raz::Profiler::endFrame();
+  Raz::Profiler::stopCapture();
+
+  CHECK(Raz::Profiler::getCapturedEvents().size() == 400);
+
+  const std::vector<Raz::Profiler::ZoneStats> stats = Raz::Profiler::getZoneStats();
+  REQUIRE(stats.size() == 1);
+  CHECK(stats.front().callCount == 400);
+
+  Raz::Profiler::clear();
+}
+#endif
@@ -0,0 +1,134 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/FloatUtils.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+std::vector<Raz::Ray> createRandomRays(std::mt19937& randGenerator, std::size_t rayCount) {
+  std::uniform_real_distribution<float> posDistrib(-5.f, 5.f);
+  std::uniform_real_distribution<float> dirDistrib(-1.f, 1.f);
+
+  std::vector<Raz::Ray> rays;
+  rays.reserve(rayCount);
+
+  for (std::size_t rayIndex = 0; rayIndex < rayCount; ++rayIndex) {
+    rays.emplace_back(Raz::Vec3f(posDistrib(randGenerator), posDistrib(randGenerator), posDistrib(randGenerator)),
+                      Raz::Vec3f(dirDistrib(randGenerator), dirDistrib(randGenerator), dirDistrib(randGenerator)).normalize());
+  }
+
+  // Adding axis-aligned rays, whose inverse direction has infinite components
+  rays[0] = Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), Raz::Axis::X);
+  rays[1] = Raz::Ray(Raz::Vec3f(0.f, 0.f, 5.f), -Raz::Axis::Z);
+
+  return rays;
+}
+
+template <std::size_t Size>
+void checkPacketIntersections() {
+  std::mt19937 randGenerator(42);
+  const std::vector<Raz::Ray> rays = createRandomRays(randGenerator, Size * 32);
+
+  const Raz::AABB aabb(Raz::Vec3f(-1.f, -1.5f, -0.5f), Raz::Vec3f(1.f, 0.5f, 1.5f));
+  const Raz::Triangle triangle(Raz::Vec3f(-3.f, -1.f, 0.5f), Raz::Vec3f(2.f, -0.5f, -1.f), Raz::Vec3f(0.f, 3.f, 0.f));
+
+  // Each packet must give the same results as the scalar checks
+  for (std::size_t rayIndex = 0; rayIndex < rays.size(); rayIndex += Size) {
+    const Raz::RayPacket<Size> rayPacket(&rays[rayIndex], Size);
+
+    std::array<float, Size> boxDistances {};
+    const uint32_t boxHitBits = rayPacket.intersects(aabb, &boxDistances);
+
+    std::array<Raz::RayHit, Size> triangleHits {};
+    const uint32_t triangleHitBits = rayPacket.intersects(triangle, &triangleHits);
+
+    for (std::size_t laneIndex = 0; laneIndex < Size; ++laneIndex) {
+      const Raz::Ray& ray = rays[rayIndex + laneIndex];
+
+      Raz::RayHit boxHit;
+      const bool hitsBox = ray.intersects(aabb, &boxHit);
+      CHECK(hitsBox == ((boxHitBits & (1u << laneIndex)) != 0));
+
+      if (hitsBox)
+        CHECK((boxDistances[laneIndex] == boxHit.distance || (std::isnan(boxDistances[laneIndex]) && std::isnan(boxHit.distance))));
+
+      Raz::RayHit triangleHit;
+      const bool hitsTriangle = ray.intersects(triangle, &triangleHit);
+      CHECK(hitsTriangle == ((triangleHitBits & (1u << laneIndex)) != 0));
+
+      if (hitsTriangle) {
+        CHECK(Raz::FloatUtils::areNearlyEqual(triangleHits[laneIndex].distance, triangleHit.distance));
+        CHECK(Raz::FloatUtils::areNearlyEqual(triangleHits[laneIndex].position, triangleHit.position));
+        CHECK(triangleHits[laneIndex].normal == triangleHit.normal);
+      }
+    }
+  }
+
+  // Checking a single ray against several boxes at once
+  std::vector<Raz::AABB> boxes;
+
+  for (std::size_t boxIndex = 0; boxIndex < Size; ++boxIndex) {
+    const Raz::Vec3f minPos(static_cast<float>(boxIndex) - 4.f, -1.f, static_cast<float>(boxIndex % 3) - 1.f);
+    boxes.emplace_back(minPos, minPos + 0.75f);
+  }
+
+  const Raz::AABBPacket<Size> boxPacket(boxes.data(), Size);
+
+  for (const Raz::Ray& ray : rays) {
+    std::array<float, Size> distances {};
+    const uint32_t hitBits = boxPacket.intersects(ray, &distances);
+
+    for (std::size_t boxIndex = 0; boxIndex < Size; ++boxIndex) {
+      float distance {};
+      const bool hitsBox = ray.intersects(boxes[boxIndex], distance);
+      CHECK(hitsBox == ((hitBits & (1u << boxIndex)) != 0));
+
+      // Rays starting exactly on a box's face while being parallel to it give NaN distances, with both versions alike
+      if (hitsBox)
+        CHECK((distances[boxIndex] == distance || (std::isnan(distances[boxIndex]) && std::isnan(distance))));
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("RayPacket basic") {
+  Raz::RayPacket4 packet;
+  CHECK(packet.getActiveMask() == 0);
+  CHECK(packet.intersects(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))) == 0);
+
+  packet.setRay(2, Raz::Ray(Raz::Vec3f(0.f, 0.f, -5.f), Raz::Axis::Z));
+  CHECK(packet.getActiveMask() == 0b0100);
+  CHECK(packet.getRay(2).getOrigin() == Raz::Vec3f(0.f, 0.f, -5.f));
+  CHECK(packet.getRay(2).getDirection() == Raz::Axis::Z);
+
+  // Only active rays can give a hit
+  std::array<float, 4> distances {};
+  CHECK(packet.intersects(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)), &distances) == 0b0100);
+  CHECK(distances[2] == 4.f);
+
+  packet.clear();
+  CHECK(packet.getActiveMask() == 0);
+
+  const std::array<Raz::Ray, 3> rays = { Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::X),
+                                         Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Y),
+                                         Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z) };
+  const Raz::RayPacket8 rayPacket8(rays.data(), rays.size());
+  CHECK(rayPacket8.getActiveMask() == 0b00000111);
+
+  const Raz::AABB box(Raz::Vec3f(-1.f), Raz::Vec3f(1.f));
+  const Raz::AABBPacket4 boxPacket(&box, 1);
+  CHECK(boxPacket.getActiveMask() == 0b0001);
+}
+
+TEST_CASE("RayPacket4 intersections") {
+  checkPacketIntersections<4>();
+}
+
+TEST_CASE("RayPacket8 intersections") {
+  checkPacketIntersections<8>();
+}
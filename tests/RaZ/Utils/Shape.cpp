@@ -350,3 +350,26 @@ TEST_CASE("AABB point containment") {
   CHECK_FALSE(aabb2.contains(point5));
   CHECK_FALSE(aabb3.contains(point5));
 }
+
+TEST_CASE("Shape bounding box") {
+  CHECK(line3.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(1.5f, 2.5f, 0.f));
+  CHECK(line3.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(5.5f, 5.f, 0.f));
+
+  CHECK(plane1.computeBoundingBox().contains(Raz::Vec3f(1000.f, -1000.f, 1000.f)));
+
+  CHECK(sphere2.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(0.f, 5.f, -5.f));
+  CHECK(sphere2.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(10.f, 15.f, 5.f));
+
+  CHECK(triangle3.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(-1.5f, -1.75f, -1.f));
+  CHECK(triangle3.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(0.f, -1.f, 1.f));
+
+  CHECK(aabb2.computeBoundingBox().getLeftBottomBackPos() == aabb2.getLeftBottomBackPos());
+  CHECK(aabb2.computeBoundingBox().getRightTopFrontPos() == aabb2.getRightTopFrontPos());
+
+  // Rotating an OBB by 90° around the Z axis swaps its X & Y extents
+  const Raz::OBB obb(aabb2, Raz::Mat3f(0.f, -1.f, 0.f,
+                                       1.f,  0.f, 0.f,
+                                       0.f,  0.f, 1.f));
+  CHECK(obb.computeBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(2.5f, 2.5f, -5.f));
+  CHECK(obb.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(4.5f, 5.5f, 5.f));
+}
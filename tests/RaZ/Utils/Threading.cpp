@@ -2,6 +2,7 @@
 
 #include "RaZ/Utils/Threading.hpp"
 
+#include <atomic>
 #include <numeric>
 #include <random>
 
@@ -92,4 +93,82 @@ TEST_CASE("Iterator parallelization - indivisible size") {
   CHECK(sumBeforeIncrement + values.size() == sumAfterIncrement);
 }
 
+TEST_CASE("ThreadPool submission") {
+  Raz::Threading::ThreadPool threadPool(2);
+  CHECK(threadPool.getThreadCount() == 2);
+
+  std::future<int> res = threadPool.submit([] (int value) noexcept { return value * 2; }, 21);
+  CHECK(res.get() == 42);
+
+  std::future<void> exceptionRes = threadPool.submit([] () { throw std::runtime_error("Error: Test exception"); });
+  CHECK_THROWS_AS(exceptionRes.get(), std::runtime_error);
+
+  std::vector<std::future<std::size_t>> results;
+
+  for (std::size_t i = 0; i < 100; ++i)
+    results.emplace_back(threadPool.submit([i] () noexcept { return i; }));
+
+  std::size_t sum = 0;
+
+  for (std::future<std::size_t>& result : results)
+    sum += result.get();
+
+  CHECK(sum == 4950);
+}
+
+TEST_CASE("ThreadPool parallel for") {
+  Raz::Threading::ThreadPool threadPool(4);
+
+  std::vector<int> values(2083);
+  fillRandom(values);
+
+  const std::size_t sumBeforeIncrement = computeSum(values);
+
+  // Each index must be processed exactly once, whatever the grain size
+  for (const std::size_t grainSize : { 0, 1, 100, 2083, 5000 }) {
+    threadPool.parallelFor(0, values.size(), [&values] (Raz::Threading::IndexRange range) noexcept {
+      for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+        ++values[i];
+    }, grainSize);
+  }
+
+  CHECK(computeSum(values) == sumBeforeIncrement + values.size() * 5);
+
+  // An empty range does nothing
+  threadPool.parallelFor(10, 10, [] (Raz::Threading::IndexRange) { FAIL("The action should not be called."); });
+}
+
+TEST_CASE("ThreadPool task group") {
+  Raz::Threading::ThreadPool threadPool(2);
+  std::atomic<std::size_t> counter = 0;
+
+  {
+    Raz::Threading::TaskGroup taskGroup(threadPool);
+
+    for (std::size_t i = 0; i < 50; ++i) {
+      // Tasks can themselves wait for other tasks without blocking the pool, since waiting threads execute pending tasks
+      taskGroup.run([&threadPool, &counter] () {
+        Raz::Threading::TaskGroup nestedGroup(threadPool);
+
+        for (std::size_t j = 0; j < 10; ++j)
+          nestedGroup.run([&counter] () noexcept { ++counter; });
+
+        nestedGroup.wait();
+      });
+    }
+
+    taskGroup.wait();
+    CHECK(counter == 500);
+  }
+
+  Raz::Threading::TaskGroup taskGroup(threadPool);
+  taskGroup.run([] () { throw std::runtime_error("Error: Test exception"); });
+  taskGroup.run([&counter] () noexcept { ++counter; });
+  CHECK_THROWS_AS(taskGroup.wait(), std::runtime_error);
+  CHECK(counter == 501);
+
+  // The exception has been consumed
+  CHECK_NOTHROW(taskGroup.wait());
+}
+
 #endif // RAZ_THREADS_AVAILABLE
@@ -1,7 +1,48 @@
 #include "Catch.hpp"
 
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/World.hpp"
 
+#include <array>
+#include <thread>
+
+namespace {
+
+class TransformSystem final : public Raz::System {
+public:
+  TransformSystem() { m_acceptedComponents.setBit(Raz::Component::getId<Raz::Transform>()); }
+
+  const std::vector<Raz::Entity*>& getEntities() const { return m_entities; }
+};
+
+class CountingSystem final : public Raz::System {
+public:
+  explicit CountingSystem(std::size_t updateCount) : m_remainingUpdateCount{ updateCount } {
+    m_writeComponents.setBit(Raz::Component::getId<Raz::RigidBody>());
+  }
+
+  bool update(float) override { return (--m_remainingUpdateCount > 0); }
+
+private:
+  std::size_t m_remainingUpdateCount {};
+};
+
+class SteppingSystem final : public Raz::System {
+public:
+  std::size_t getStepCount() const noexcept { return m_stepCount; }
+
+  bool step(float) override {
+    ++m_stepCount;
+    return true;
+  }
+
+private:
+  std::size_t m_stepCount = 0;
+};
+
+} // namespace
+
 TEST_CASE("World refresh") {
   Raz::World world(3);
 
@@ -60,3 +101,353 @@ TEST_CASE("World refresh") {
   CHECK(world.getEntities()[1]->getId() == 1);
   CHECK(world.getEntities()[2]->getId() == 0);
 }
+
+TEST_CASE("World systems linking") {
+  Raz::World world(3);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>();
+
+  // Entities existing before a system's addition are linked to it immediately
+  const auto& system = world.addSystem<TransformSystem>();
+  CHECK(system.getEntities() == std::vector<Raz::Entity*>({ &entity0 }));
+
+  Raz::Entity& entity1 = world.addEntity();
+  entity1.addComponent<Raz::Transform>();
+
+  // Changes are only applied to the systems when the world is refreshed
+  CHECK(system.getEntities().size() == 1);
+  world.refresh();
+  CHECK(system.getEntities() == std::vector<Raz::Entity*>({ &entity0, &entity1 }));
+
+  // Disabled entities are unlinked
+  entity0.disable();
+  world.refresh();
+  CHECK(system.getEntities() == std::vector<Raz::Entity*>({ &entity1 }));
+
+  // Entities without any accepted component are unlinked
+  entity1.removeComponent<Raz::Transform>();
+  entity0.enable();
+  world.refresh();
+  CHECK(system.getEntities() == std::vector<Raz::Entity*>({ &entity0 }));
+
+  // Refreshing with no change leaves the systems untouched
+  world.refresh();
+  CHECK(system.getEntities() == std::vector<Raz::Entity*>({ &entity0 }));
+}
+
+TEST_CASE("World systems update") {
+  Raz::World world;
+
+  const auto& transformSystem = world.addSystem<TransformSystem>();
+  const auto& countingSystem  = world.addSystem<CountingSystem>(2);
+
+  CHECK_FALSE(transformSystem.hasDeclaredAccesses());
+  CHECK(countingSystem.hasDeclaredAccesses());
+
+  // Both systems conflict, since the transform system has not declared its accesses
+  CHECK(world.update(0.02f));
+  REQUIRE(world.getSystemGraph().getNodeCount() == 2);
+  CHECK(world.getSystemGraph().getNode(1).getParentCount() == 1);
+
+  // Once a system is inactive, it is not updated anymore
+  CHECK(world.update(0.02f));
+  CHECK(world.update(0.02f));
+  CHECK(world.getSystemGraph().getNodeCount() == 1);
+  CHECK(world.getSystemGraph().getNode(0).getSystemIndex() == Raz::System::getId<TransformSystem>());
+
+  world.removeSystem<TransformSystem>();
+  CHECK_FALSE(world.update(0.02f));
+}
+
+TEST_CASE("World fixed steps") {
+  Raz::World world;
+
+  world.addSystem<TransformSystem>();
+  const auto& steppingSystem = world.addSystem<SteppingSystem>();
+
+  world.setFixedTimeStep(0.25f);
+  world.setMaxStepCount(4);
+  CHECK(world.getFixedTimeStep() == 0.25f);
+  CHECK(world.getMaxStepCount() == 4);
+
+  // The elapsed time is accumulated once per update, whatever the number of systems
+  world.update(0.125f);
+  CHECK(world.getStepCount() == 0);
+  CHECK(world.getInterpolationAlpha() == 0.5f);
+
+  world.update(0.5f);
+  CHECK(world.getStepCount() == 2);
+  CHECK(steppingSystem.getStepCount() == 2);
+  CHECK(world.getInterpolationAlpha() == 0.5f);
+
+  // Steps exceeding the maximum are dropped, only the remaining fraction of a step being kept
+  world.update(2.f);
+  CHECK(world.getStepCount() == 4);
+  CHECK(steppingSystem.getStepCount() == 6);
+  CHECK(world.getInterpolationAlpha() == 0.5f);
+
+  world.update(0.125f);
+  CHECK(world.getStepCount() == 1);
+  CHECK(steppingSystem.getStepCount() == 7);
+  CHECK(world.getInterpolationAlpha() == 0.f);
+}
+
+TEST_CASE("World dense component storage") {
+  Raz::World world(3, Raz::ComponentStorageType::DENSE);
+  REQUIRE(world.getComponentStorage() != nullptr);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f));
+  Raz::Entity& entity1 = world.addEntity();
+  Raz::Entity& entity2 = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(2.f));
+
+  CHECK(entity0.hasComponent<Raz::Transform>());
+  CHECK_FALSE(entity1.hasComponent<Raz::Transform>());
+  CHECK(entity0.getComponents().empty()); // The components are held by the world's storage
+
+  const Raz::ComponentPool<Raz::Transform>& transforms = world.getComponentStorage()->getPool<Raz::Transform>();
+  CHECK(transforms.getSize() == 2);
+  CHECK(&entity0.getComponent<Raz::Transform>() == &transforms.getAt(0));
+  CHECK(&entity2.getComponent<Raz::Transform>() == &transforms.getAt(1));
+
+  entity1.addComponent<Raz::Transform>(Raz::Vec3f(1.f));
+  CHECK(transforms.getSize() == 3);
+  CHECK(entity1.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f));
+
+  entity0.removeComponent<Raz::Transform>();
+  CHECK_FALSE(entity0.hasComponent<Raz::Transform>());
+  CHECK_THROWS(entity0.getComponent<Raz::Transform>());
+  CHECK(transforms.getSize() == 2);
+
+  // The remaining components are still accessible from their entities, even if they have been moved
+  CHECK(entity1.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f));
+  CHECK(entity2.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(2.f));
+
+  // Destroying the world releases all of the components
+  world.destroy();
+  CHECK(transforms.getSize() == 0);
+}
+
+TEST_CASE("World view") {
+  Raz::World world(3);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity1 = world.addEntity();
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::RigidBody>(0.f, 0.f);
+
+  // Entities existing before the view's creation are matched
+  const Raz::EntityView<Raz::Transform> transforms = world.view<Raz::Transform>();
+  CHECK(transforms.getSize() == 2);
+
+  // Requesting a view with the same components gives the same results
+  CHECK(&world.view<Raz::Transform>().getEntities() == &transforms.getEntities());
+
+  const Raz::EntityView<Raz::RigidBody, Raz::Transform> rigidBodies = world.view<Raz::RigidBody, Raz::Transform>();
+  CHECK(rigidBodies.getSize() == 1);
+
+  // The views are updated as soon as components are added or removed
+  entity1.addComponent<Raz::Transform>();
+  CHECK(transforms.getSize() == 3);
+  CHECK(rigidBodies.getSize() == 1);
+
+  entity0.addComponent<Raz::RigidBody>(1.f, 0.f);
+  CHECK(rigidBodies.getSize() == 2);
+
+  entity0.removeComponent<Raz::Transform>();
+  CHECK(transforms.getSize() == 2);
+  CHECK(rigidBodies.getSize() == 1);
+
+  // Disabled entities are excluded from the views
+  entity1.disable();
+  CHECK(transforms.getSize() == 1);
+
+  entity1.enable();
+  CHECK(transforms.getSize() == 2);
+
+  // Newly added entities are matched as well
+  world.addEntityWithComponent<Raz::Transform>();
+  CHECK(transforms.getSize() == 3);
+
+  // Moving the world keeps the views up to date
+  Raz::World movedWorld = std::move(world);
+  const Raz::EntityView<Raz::Transform> movedTransforms = movedWorld.view<Raz::Transform>();
+  CHECK(movedTransforms.getSize() == 3);
+
+  entity1.removeComponent<Raz::Transform>();
+  CHECK(movedTransforms.getSize() == 2);
+}
+
+TEST_CASE("World entity removal") {
+  Raz::World world(3);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity1 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity2 = world.addEntityWithComponent<Raz::Transform>();
+
+  const auto& transformSystem = world.addSystem<TransformSystem>();
+  const Raz::EntityView<Raz::Transform> transforms = world.view<Raz::Transform>();
+  world.refresh();
+
+  CHECK(transformSystem.getEntities().size() == 3);
+  CHECK(transforms.getSize() == 3);
+
+  const Raz::EntityHandle handle0 = entity0.getHandle();
+  const Raz::EntityHandle handle1 = entity1.getHandle();
+  CHECK(world.isAlive(handle1));
+  CHECK(world.getEntity(handle1) == &entity1);
+  CHECK_FALSE(world.isAlive(Raz::EntityHandle()));
+
+  // The removed entity is immediately unlinked from the systems & views, & its handle becomes stale
+  world.removeEntity(entity1);
+
+  CHECK(world.getEntities().size() == 2);
+  CHECK(transformSystem.getEntities().size() == 2);
+  CHECK(transforms.getSize() == 2);
+  CHECK_FALSE(world.isAlive(handle1));
+  CHECK(world.getEntity(handle1) == nullptr);
+  CHECK_FALSE(world.removeEntity(handle1));
+
+  CHECK(world.getEntity(handle0) == &entity0);
+  CHECK(world.getEntity(entity2.getHandle()) == &entity2);
+
+  // The freed index is given to the next added entity, with a new generation
+  Raz::Entity& entity3 = world.addEntityWithComponent<Raz::Transform>();
+  CHECK(entity3.getId() == 1);
+  CHECK(entity3.getGeneration() == 1);
+  CHECK_FALSE(world.isAlive(handle1));
+  CHECK(world.getEntity(entity3.getHandle()) == &entity3);
+
+  world.refresh();
+  CHECK(transformSystem.getEntities().size() == 3);
+  CHECK(transforms.getSize() == 3);
+
+  // Disabled entities are kept at the end of the list
+  entity2.disable();
+  world.refresh();
+  CHECK(world.removeEntity(handle0));
+
+  REQUIRE(world.getEntities().size() == 2);
+  CHECK(world.getEntities()[0].get() == &entity3);
+  CHECK(world.getEntities()[1].get() == &entity2);
+  CHECK(transformSystem.getEntities().size() == 1);
+
+  // Removing an entity which has changed since the last refresh is handled as well
+  entity3.removeComponent<Raz::Transform>();
+  world.removeEntity(entity3);
+  world.removeEntity(entity2);
+  world.refresh();
+
+  CHECK(world.getEntities().empty());
+  CHECK(transformSystem.getEntities().empty());
+  CHECK(transforms.isEmpty());
+}
+
+TEST_CASE("World entity removal dense storage") {
+  Raz::World world(2, Raz::ComponentStorageType::DENSE);
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f));
+  Raz::Entity& entity1 = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f));
+
+  const Raz::ComponentPool<Raz::Transform>& transforms = world.getComponentStorage()->getPool<Raz::Transform>();
+  CHECK(transforms.getSize() == 2);
+
+  world.removeEntity(entity0);
+  CHECK(transforms.getSize() == 1);
+  CHECK(entity1.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f));
+
+  // The recycled index must not give access to the removed entity's component
+  Raz::Entity& entity2 = world.addEntity();
+  CHECK(entity2.getId() == 0);
+  CHECK_FALSE(entity2.hasComponent<Raz::Transform>());
+}
+
+TEST_CASE("World command buffer") {
+  Raz::World world(2);
+  auto& transformSystem = world.addSystem<TransformSystem>();
+
+  Raz::Entity& entity0 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity1 = world.addEntity();
+  const Raz::EntityHandle handle0 = entity0.getHandle();
+  const Raz::EntityHandle handle1 = entity1.getHandle();
+  world.refresh();
+
+  Raz::World::CommandBuffer& buffer = world.getCommandBuffer();
+  CHECK(&world.getCommandBuffer() == &buffer); // The same thread always gets the same buffer
+  CHECK(buffer.isEmpty());
+
+  const Raz::World::CommandBuffer::PendingEntity pendingEntity = buffer.addEntity();
+  buffer.addComponent<Raz::Transform>(pendingEntity, Raz::Vec3f(2.f));
+  buffer.addComponent<Raz::Transform>(handle1, Raz::Vec3f(1.f));
+  buffer.removeComponent<Raz::Transform>(handle0);
+  CHECK(buffer.getCommandCount() == 4);
+
+  // Nothing is applied until the buffers are executed
+  CHECK(world.getEntities().size() == 2);
+  CHECK(entity0.hasComponent<Raz::Transform>());
+  CHECK_FALSE(entity1.hasComponent<Raz::Transform>());
+
+  world.executeCommandBuffers();
+  CHECK(buffer.isEmpty());
+
+  REQUIRE(world.getEntities().size() == 3);
+  CHECK_FALSE(entity0.hasComponent<Raz::Transform>());
+  REQUIRE(entity1.hasComponent<Raz::Transform>());
+  CHECK(entity1.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f));
+  const Raz::Entity& entity2 = *world.getEntities()[2];
+  REQUIRE(entity2.hasComponent<Raz::Transform>());
+  CHECK(entity2.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(2.f));
+
+  world.refresh();
+  CHECK(transformSystem.getEntities().size() == 2);
+
+  // Commands targeting removed entities are ignored
+  buffer.removeEntity(handle0);
+  buffer.disableEntity(handle0);
+  buffer.addComponent<Raz::Transform>(handle0);
+  buffer.disableEntity(handle1);
+  world.executeCommandBuffers();
+
+  CHECK_FALSE(world.isAlive(handle0));
+  CHECK(world.getEntities().size() == 2);
+  CHECK_FALSE(entity1.isEnabled());
+
+  world.refresh();
+  CHECK(transformSystem.getEntities().size() == 1);
+}
+
+TEST_CASE("World command buffer multithreaded") {
+  Raz::World world;
+  world.addSystem<TransformSystem>();
+
+  constexpr std::size_t threadCount = 4;
+  constexpr std::size_t entityCountPerThread = 100;
+
+  std::array<Raz::World::CommandBuffer*, threadCount> buffers {};
+  std::vector<std::thread> threads;
+
+  for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+    threads.emplace_back([&world, &buffers, threadIndex] () {
+      Raz::World::CommandBuffer& buffer = world.getCommandBuffer();
+      buffers[threadIndex] = &buffer;
+
+      for (std::size_t entityIndex = 0; entityIndex < entityCountPerThread; ++entityIndex)
+        buffer.addComponent<Raz::Transform>(buffer.addEntity(), Raz::Vec3f(static_cast<float>(threadIndex)));
+    });
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // Each thread has recorded into its own buffer
+  for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+    CHECK(buffers[threadIndex]->getCommandCount() == entityCountPerThread * 2);
+
+    for (std::size_t otherIndex = threadIndex + 1; otherIndex < threadCount; ++otherIndex)
+      CHECK(buffers[threadIndex] != buffers[otherIndex]);
+  }
+
+  // The buffers are played back at the beginning of the update
+  world.update({});
+  CHECK(world.getEntities().size() == threadCount * entityCountPerThread);
+  CHECK(world.getSystem<TransformSystem>().getEntities().size() == threadCount * entityCountPerThread);
+  CHECK(world.view<Raz::Transform>().getSize() == threadCount * entityCountPerThread);
+}